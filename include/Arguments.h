@@ -22,11 +22,32 @@
 #include <string>
 #include <cstdint>
 #include <map>
+#include <vector>
 #include <argp.h>
 #include "main.h"
+#include "StreamServer.h"
 
 #define ETH_ALEN 6
 
+// Keys of options without a short form
+enum longOption
+{
+    OPTION_PIPELINE = 0x100,
+    OPTION_THREADS,
+    OPTION_EVENTS_ONLY,
+    OPTION_FIXED_POINT,
+    OPTION_CACHE_DIR,
+    OPTION_CACHE_SIZE,
+    OPTION_NO_CACHE,
+    OPTION_PROCESS,
+    OPTION_UDP_BATCH,
+    OPTION_UDP_LATENCY,
+    OPTION_UDP_MTU,
+    OPTION_STREAM,
+    OPTION_STREAM_QUEUE,
+    OPTION_STREAM_OVERFLOW,
+};
+
 struct Args
 {
     bool strict;
@@ -63,6 +84,21 @@ struct Args
     uint8_t ftmTargetMac[ETH_ALEN];
     std::string inputFile;
     std::map<enum processor, bool> processors;
+    std::string pipeline;
+    uint32_t threads = 0;
+    bool eventsOnly = false;
+    std::string fixedPoint;
+    std::string cacheDir;
+    uint64_t cacheSize = 1024; // MiB
+    bool noCache = false;
+    bool process = false;
+    std::vector<std::string> inputFiles;
+    uint32_t udpBatch = 32;
+    uint32_t udpLatency = 2000; // us
+    uint32_t udpMtu = 0;
+    std::string stream;
+    uint32_t streamQueue = STREAM_SERVER_QUEUE_FRAMES;
+    enum StreamServer::overflow streamOverflow = StreamServer::overflow::dropOldest;
 };
 
 class Arguments
@@ -83,7 +119,7 @@ private:
         "FeitCSI - FeitCSI, the tool that enables CSI extraction and injection IEEE 802.11 frames";
 
     /* A description of the arguments we accept. */
-    inline static char args_doc[] = "ARG1 ARG2";
+    inline static char args_doc[] = "[INPUT...]";
 
     /* The options we understand. */
     inline static struct argp_option options[] = {
@@ -114,6 +150,20 @@ private:
         {"mode-delay", 'y', "SWAPTIME", 0, "Delay in ms between inject and ftm responder or measure and ftm initiator when modes are injectftmres|measureftm"},
         {"strict", 'z', 0, OPTION_ARG_OPTIONAL, "Strict mode: filter out values that do not contain a specific MCS"},
         {"mac", '#', "MAC", 0, "Default NICs MAC will be change to providing MAC xx:xx:xx:xx:xx:xx"},
+        {"pipeline", OPTION_PIPELINE, "STAGES", 0, "Comma separated CSI processing stages in order [interpolateLinear|interpolateCubic|interpolateCosine|interpolateComplex|phaseCalibration|cir|doppler|hampel|statistics|pca|music|csiRatio|resample|motion|features]"},
+        {"threads", OPTION_THREADS, "THREADS", 0, "Number of worker threads for offline processing, 0 uses all cores"},
+        {"fixed-point", OPTION_FIXED_POINT, "STAGES", 0, "Comma separated stages run on captured CSI in integer arithmetic before the pipeline, capture only, not used by --process or GUI processing [interpolateLinear|phaseCalibration]"},
+        {"udp-batch", OPTION_UDP_BATCH, "FRAMES", 0, "Maximum CSI frames sent to UDP client with one system call, 1 sends every frame right away"},
+        {"udp-latency", OPTION_UDP_LATENCY, "US", 0, "Maximum time in us a CSI frame waits for its UDP batch to fill"},
+        {"udp-mtu", OPTION_UDP_MTU, "BYTES", 0, "Split CSI frames sent to UDP client into chunks fitting MTU, see CsiChunk.h, 0 sends whole frames, not supported with --plot"},
+        {"stream", OPTION_STREAM, "ADDRESS", 0, "Stream captured CSI frames in .dat file format to TCP clients on [HOST:]PORT or Unix socket clients on unix:PATH"},
+        {"stream-queue", OPTION_STREAM_QUEUE, "FRAMES", 0, "Maximum CSI frames queued for a stream client"},
+        {"stream-overflow", OPTION_STREAM_OVERFLOW, "POLICY", 0, "What happens when the queue of a stream client is full [drop-oldest|disconnect|block]"},
+        {"process", OPTION_PROCESS, 0, OPTION_ARG_OPTIONAL, "Process INPUT files or globs with --pipeline without GUI, outputs go to -o directory or next to inputs, stage output= and shm= are not supported"},
+        {"cache-dir", OPTION_CACHE_DIR, "DIR", 0, "Directory of processed output cache, default ~/.cache/FeitCSI"},
+        {"cache-size", OPTION_CACHE_SIZE, "MIB", 0, "Size limit of processed output cache in MiB, least recently used outputs are removed"},
+        {"no-cache", OPTION_NO_CACHE, 0, OPTION_ARG_OPTIONAL, "Always process input, do not read or write processed output cache"},
+        {"events-only", OPTION_EVENTS_ONLY, 0, OPTION_ARG_OPTIONAL, "Do not save or send captured CSI frames, only outputs of pipeline stages such as motion events"},
         {0}};
 };
 
@@ -0,0 +1,85 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BATCH_EXECUTOR_H
+#define BATCH_EXECUTOR_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ProcessingPipeline.h"
+
+#define BATCH_EXECUTOR_CHUNK_SIZE 64
+
+// Runs a processing pipeline over chunks of frames on a pool of worker
+// threads. Every worker owns its own pipeline instance, chunks are read in
+// order, processed concurrently and handed to a single writer thread in the
+// same order they were read. Sequential stages and everything after them
+// run on the writer thread so they see frames in capture order.
+class BatchExecutor
+{
+
+public:
+    // Fills chunk with up to chunkSize frames, returns false when input is exhausted
+    typedef std::function<bool(std::vector<Csi *> &chunk, uint32_t chunkSize)> ChunkReader;
+    // Called on the writer thread with chunks in capture order
+    typedef std::function<void(std::vector<Csi *> &chunk)> ChunkWriter;
+
+    BatchExecutor(const std::string &pipelineSpec, uint32_t threadCount = 0, uint32_t chunkSize = BATCH_EXECUTOR_CHUNK_SIZE);
+
+    void run(const ChunkReader &reader, const ChunkWriter &writer);
+    void printStatistics(uint64_t bytes = 0);
+
+    uint32_t getThreadCount() const;
+
+private:
+    std::string pipelineSpec;
+    uint32_t threadCount;
+    uint32_t chunkSize;
+    uint32_t maxChunksInFlight;
+
+    std::vector<std::unique_ptr<ProcessingPipeline>> pipelines;
+    std::unique_ptr<ProcessingPipeline> orderedPipeline;
+    uint32_t sequentialStart;
+
+    std::mutex readMutex;
+    std::mutex reorderMutex;
+    std::condition_variable chunkWritten;
+    std::condition_variable chunkProcessed;
+    std::map<uint64_t, std::vector<Csi *>> reorderBuffer;
+    uint64_t nextReadSequence = 0;
+    uint64_t nextWriteSequence = 0;
+    bool inputExhausted = false;
+    bool aborted = false;
+    std::exception_ptr failure;
+
+    uint64_t processedFrames = 0;
+    uint64_t elapsedNs = 0;
+
+    void worker(ProcessingPipeline &pipeline, const ChunkReader &reader);
+    void writer(const ChunkWriter &writer);
+    void abort(std::exception_ptr e);
+};
+
+#endif
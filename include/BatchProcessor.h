@@ -0,0 +1,89 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BATCH_PROCESSOR_H
+#define BATCH_PROCESSOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "BatchExecutor.h"
+#include "CsiArena.h"
+#include "ProcessedCache.h"
+
+#define BATCH_PROCESSOR_OUTPUT_EXTENSION ".processed.bin"
+
+// Headless processing of many capture files (--process). Every worker
+// thread owns a deque of files, takes work from its front and steals from
+// the back of other deques when it runs dry. Files are dealt largest first,
+// so big files start early and small ones fill the gaps at the end. A file
+// is streamed from its mapping chunk by chunk through a pipeline of its own,
+// sequential stages see its frames in capture order and memory stays bounded
+// by one chunk per worker.
+class BatchProcessor
+{
+
+public:
+    BatchProcessor(const std::string &pipelineSpec, uint32_t threadCount = 0, uint32_t chunkSize = BATCH_EXECUTOR_CHUNK_SIZE);
+
+    // Expands glob patterns, skipping outputs of earlier runs (BATCH_PROCESSOR_OUTPUT_EXTENSION),
+    // throws std::invalid_argument when a pattern matches nothing
+    static std::vector<std::string> expandInputs(const std::vector<std::string> &patterns);
+
+    // Output of input dir/name.ext goes to outputDirectory/name.processed.bin, next to the input when empty.
+    // Throws std::invalid_argument before processing anything when two inputs map to one output.
+    // Returns number of files which failed.
+    uint32_t run(const std::vector<std::string> &inputFiles, const std::string &outputDirectory, ProcessedCache *cache = nullptr);
+    void printStatistics();
+
+private:
+    struct FileQueue
+    {
+        std::mutex mutex;
+        std::deque<size_t> files;
+    };
+
+    std::string pipelineSpec;
+    uint32_t threadCount;
+    uint32_t chunkSize;
+
+    std::vector<std::unique_ptr<FileQueue>> queues;
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    ProcessedCache *cache = nullptr;
+    std::mutex logMutex;
+
+    std::atomic<uint64_t> processedFiles{0};
+    std::atomic<uint64_t> cachedFiles{0};
+    std::atomic<uint64_t> failedFiles{0};
+    std::atomic<uint64_t> stolenFiles{0};
+    std::atomic<uint64_t> processedFrames{0};
+    std::atomic<uint64_t> bytesRead{0};
+    std::atomic<uint64_t> bytesWritten{0};
+    uint64_t elapsedNs = 0;
+
+    bool nextFile(uint32_t worker, size_t &file);
+    void worker(uint32_t id);
+    void processFile(CsiArena &arena, size_t file);
+};
+
+#endif
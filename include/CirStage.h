@@ -0,0 +1,69 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CIR_STAGE_H
+#define CIR_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "Fft.h"
+#include "ProcessingStage.h"
+
+// Computes the channel impulse response of every chain into Csi::cir.
+// Reported subcarriers are placed on their FFT bins by logical index k, DC,
+// null and guard tones stay zero, the band is windowed and inverse transformed.
+//
+// Params: window=rectangular|hann|hamming|blackman (default hann),
+//         size=N minimal IFFT size, larger than the layout FFT size oversamples the delay axis.
+class CirStage : public ProcessingStage
+{
+
+public:
+    enum window
+    {
+        rectangular,
+        hann,
+        hamming,
+        blackman
+    };
+
+    explicit CirStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    // Where every reported subcarrier goes in the IFFT input and its window weight
+    struct Plan
+    {
+        const Fft *fft;
+        std::vector<uint32_t> bins;
+        std::vector<double> weights;
+    };
+
+    enum window windowType = window::hann;
+    uint32_t minSize = 0;
+    std::map<const SubcarrierLayout *, Plan> plans;
+
+    const Plan &getPlan(const SubcarrierLayout &layout);
+    void transform(Csi &csi);
+};
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMPLEX_INTERPOLATION_STAGE_H
+#define COMPLEX_INTERPOLATION_STAGE_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "ProcessingStage.h"
+
+// Replaces masked subcarriers with values interpolated from the remaining ones
+// directly on complex CSI, so phase wrapping does not matter. Interpolation
+// runs over the logical subcarrier index k, neighbours across DC, null tones
+// and the firmware gap are weighted by their real distance.
+//
+// Params: method=linear|hermite|spline (default spline),
+//         mask=pilots|none (default pilots),
+//         bins=i+j+... additional reported subcarrier positions to replace.
+//
+// Weights depend only on the layout, they are computed once per layout and
+// applied to every chain as a sparse stencil.
+class ComplexInterpolationStage : public ProcessingStage
+{
+
+public:
+    enum method
+    {
+        linear,
+        hermite,
+        spline
+    };
+
+    explicit ComplexInterpolationStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    // Masked subcarrier targets[t] = sum of weights[j] * csi[sources[j]] for j in [offsets[t], offsets[t + 1])
+    struct Stencil
+    {
+        std::vector<uint32_t> targets;
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> sources;
+        std::vector<double> weights;
+    };
+
+    enum method interpolationMethod = method::spline;
+    bool maskPilots = true;
+    std::vector<uint32_t> bins;
+    std::map<const SubcarrierLayout *, Stencil> stencils;
+
+    const Stencil &getStencil(const SubcarrierLayout &layout);
+    void buildWeights(const std::vector<double> &x, double target, std::map<uint32_t, double> &weights) const;
+    void interpolate(Csi &csi);
+};
+
+#endif
@@ -22,8 +22,12 @@
 #include <cstdint>
 #include <string>
 #include <complex>
+#include <memory_resource>
 #include <vector>
+#include "UdpBatchSender.h"
 #include "UdpSocket.h"
+#include "StreamServer.h"
+#include "SubcarrierLayout.h"
 
 #define CSI_HEADER_LENGTH 272
 
@@ -48,24 +52,47 @@ struct __attribute__((__packed__)) RawHeaderData
     uint32_t space96[44];
 };
 
+// Records mixed with CSI frames in outputs and on the wire (motion events,
+// feature vectors, UDP chunks) start with a 32-bit magic of four letters "F..."
+// where frames have csiDataSize. Such values are above 0x40000000 bytes, which
+// csiDataSize never gets, so the first 4 bytes tell a record from a frame.
+
+// Signal path estimated by MusicStage
+struct PathEstimate
+{
+    float aoa;   // degrees
+    float tof;   // ns
+    float power; // MUSIC pseudo spectrum
+};
+
 class Csi
 {
 
 public:
-    Csi();
+    // Raw data and decoded vectors are allocated from resource, e.g. a CsiArena
+    explicit Csi(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
     ~Csi();
+    Csi(const Csi &) = delete;
+    Csi &operator=(const Csi &) = delete;
     // void load(uint8_t *data, uint32_t size);
     void loadFromFile(std::string fileName);
-    void loadFromMemory(uint8_t *pHeader, uint8_t *rawCsiData);
+    // decode false leaves csi, magnitude and phase empty until reset(), for the fixed point path
+    void loadFromMemory(uint8_t *pHeader, uint8_t *rawCsiData, bool decode = true);
     void loadFromMemory(uint8_t *rawData);
     void save();
     void sendUDP(UdpSocket *udpSocket);
-    void backup();
-    void restore();
+    // Queued without copy for the subscribers of udpSocket wanting it, the frame has to stay alive until udpSender is idle
+    void sendUDP(UdpBatchSender *udpSender, UdpSocket *udpSocket);
+    void sendStream(StreamServer *streamServer);
+    void reset();
+    // Output of save(), sendUDP() and sendStream() becomes the processed CSI until the next reset() or load
+    void encodeProcessed();
     void magnitudePhaseToComplex();
     void recalcMagnitudePhase();
     void unwrapPhase();
-    const std::vector<uint32_t> getPilotIndices();
+    uint64_t getSourceMac() const;
+    uint8_t *getRawCsiData() const;
+    size_t getMemoryUsage() const;
 
     RawHeaderData rawHeaderData;
     uint32_t numRx;
@@ -73,32 +100,34 @@ public:
     uint32_t numSubCarriers = 0;
     uint32_t format = 0;
     uint32_t channelWidth = 0;
-    std::vector<std::complex<double>> csi;
-    std::vector<std::complex<double>> csiBackup;
-    std::vector<double> magnitude;
-    std::vector<double> phase;
+    const SubcarrierLayout *layout = nullptr;
+    uint64_t processedKey = 0; // ProcessingPipeline state of csi, magnitude and phase, 0 is raw
+    std::pmr::vector<std::complex<double>> csi;
+    std::pmr::vector<double> magnitude;
+    std::pmr::vector<double> phase;
+    std::pmr::vector<std::complex<double>> cir; // channel impulse response of every chain, filled by CirStage
+    std::pmr::vector<PathEstimate> paths;
 
 private:
-    const std::vector<uint32_t> NO_NHT_20_PILOT_INDICES = {5, 19, 32, 46};                                                                                                                                                              // 52 subcarriers
-    const std::vector<uint32_t> HT_VHT_20_PILOT_INDICES = {7, 21, 34, 48};                                                                                                                                                              // 56 subcarriers
-    const std::vector<uint32_t> HT_VHT_40_PILOT_INDICES = {5, 33, 47, 66, 80, 108};                                                                                                                                                     // 114 subcarriers
-    const std::vector<uint32_t> VHT_80_PILOT_INDICES = {19, 47, 83, 111, 130, 158, 194, 222};                                                                                                                                           // 242 subcarriers
-    const std::vector<uint32_t> VHT_160_PILOT_INDICES = {19, 47, 83, 111, 130, 158, 194, 222, 261, 289, 325, 353, 372, 400, 436, 464};                                                                                                  // 484 subcarriers
-    const std::vector<uint32_t> HE_20_PILOT_INDICES = {6, 32, 74, 100, 141, 167, 209, 235};                                                                                                                                             // 242 subcarriers
-    const std::vector<uint32_t> HE_40_PILOT_INDICES = {6, 32, 74, 100, 140, 166, 208, 234, 249, 275, 317, 343, 383, 409, 451, 477};                                                                                                     // 484 subcarriers
-    const std::vector<uint32_t> HE_80_PILOT_INDICES = {32, 100, 166, 234, 274, 342, 408, 476, 519, 587, 653, 721, 761, 829, 895, 963};                                                                                                  // 996 subcarriers
-    const std::vector<uint32_t> HE_160_PILOT_INDICES = {32, 100, 166, 234, 274, 342, 408, 476, 519, 587, 653, 721, 761, 829, 895, 963, 1028, 1096, 1162, 1230, 1270, 1338, 1404, 1472, 1515, 1583, 1649, 1717, 1757, 1825, 1891, 1959}; // 1992 subcarriers
-
     std::string saveFilePath;
+    std::pmr::memory_resource *resource;
     uint8_t *rawCsiData = nullptr;
+    uint32_t rawCsiCapacity = 0;
+    // Written by encodeProcessed(), raw data stays what reset() decodes
+    RawHeaderData processedHeaderData;
+    uint8_t *processedCsiData = nullptr;
+    uint32_t processedCsiCapacity = 0;
+    bool processed = false;
 
+    void allocateRawCsiData(uint32_t size);
+    RawHeaderData *outputHeader();
+    uint8_t *outputCsiData();
     void fixCsiBug();
-    void processRawCsi();
+    void processRawCsi(bool decode = true);
 
     double constrainAngle(double x);
     double angleConv(double angle);
     double angleDiff(double a, double b);
-    double unwrap(double previousAngle, double newAngle);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSI_ARENA_H
+#define CSI_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+#include "Csi.h"
+
+#define CSI_ARENA_CHUNK_SIZE (4 << 20)
+
+// Bump allocator for frames loaded or captured together. Frames from
+// createCsi() and their raw data and vectors are placed one after another in
+// chunks of at least chunkSize bytes. Single deallocations are no-ops,
+// release() destroys every frame at once and rewinds to the first chunk, so
+// chunks are reused and reloading or capturing in steady state does not touch
+// the heap. Allocation is thread safe, stages such as MusicStage grow vectors
+// of frames from their worker threads. release() is not, it must only run
+// once nobody uses the frames any more.
+class CsiArena : public std::pmr::memory_resource
+{
+
+public:
+    explicit CsiArena(size_t chunkSize = CSI_ARENA_CHUNK_SIZE);
+    ~CsiArena();
+    CsiArena(const CsiArena &) = delete;
+    CsiArena &operator=(const CsiArena &) = delete;
+
+    Csi *createCsi();
+    void release();
+    size_t getFrameCount() const;
+    void printStatistics() const;
+
+    uint64_t chunkAllocations = 0; // heap allocations, constant once the arena is warm
+    uint64_t allocations = 0;      // blocks served from chunks
+    uint64_t chunkBytes = 0;
+
+private:
+    struct Chunk
+    {
+        uint8_t *data;
+        size_t size;
+    };
+
+    size_t chunkSize;
+    std::mutex mutex; // guards chunks, current, offset, frames and counters
+    std::vector<Chunk> chunks;
+    size_t current = 0;
+    size_t offset = 0;
+    std::vector<Csi *> frames;
+
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+};
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSI_CHUNK_H
+#define CSI_CHUNK_H
+
+#include <cstdint>
+
+// "FCHK" in little endian, record magic, see RawHeaderData in Csi.h
+#define CSI_CHUNK_MAGIC 0x4b484346
+// IPv6 and UDP headers, the larger of IPv4 and IPv6
+#define CSI_CHUNK_IP_OVERHEAD 48
+#define CSI_CHUNK_MIN_MTU 576
+
+// Datagram of the chunked UDP stream (--udp-mtu). A frame, CSI header
+// followed by CSI data exactly as in the .dat file, is cut into chunks of
+// at most MTU - CSI_CHUNK_IP_OVERHEAD - sizeof(CsiChunkHeader) bytes, so no
+// datagram gets fragmented by IP. Chunk 0 starts at offset 0 and carries the
+// CSI header. CsiReassembler puts frames back together.
+struct __attribute__((__packed__)) CsiChunkHeader
+{
+    uint32_t magic;      // CSI_CHUNK_MAGIC
+    uint32_t frameId;    // increments by one per captured frame, wraps around, shared by all subscribers
+                         // so frames filtered out for a subscriber show up as missing
+    uint32_t frameSize;  // bytes of CSI header and data
+    uint32_t offset;     // of this chunk in the frame
+    uint16_t chunkIndex;
+    uint16_t chunkCount;
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSI_FRAME_STORE_H
+#define CSI_FRAME_STORE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Csi.h"
+#include "ProcessingPipeline.h"
+
+#define CSI_FRAME_STORE_CACHE_SIZE 32
+#define CSI_FRAME_STORE_PREFETCH 4
+
+// Random access to the frames of a capture file without decoding all of them.
+// The file is mapped read only and only frame offsets are kept (8 bytes per
+// frame), a frame is decoded and processed when it is accessed. The last
+// cacheSize frames stay decoded (LRU), and after every access the prefetch
+// frames on both sides are decoded on a background thread, so stepping
+// through a capture usually hits the cache. With prefetch 0 no thread is started.
+class CsiFrameStore
+{
+
+public:
+    explicit CsiFrameStore(size_t cacheSize = CSI_FRAME_STORE_CACHE_SIZE, uint32_t prefetch = CSI_FRAME_STORE_PREFETCH);
+    ~CsiFrameStore();
+    CsiFrameStore(const CsiFrameStore &) = delete;
+    CsiFrameStore &operator=(const CsiFrameStore &) = delete;
+
+    // Throws std::ios_base::failure when the file can not be mapped
+    void open(const std::string &fileName);
+    void close();
+    void setPipeline(const std::string &spec);
+
+    size_t size() const;
+    // Decoded and processed frame, stays valid while the pointer is held
+    std::shared_ptr<Csi> get(size_t index);
+    // Header followed by raw CSI data of frame, as stored in the file
+    const uint8_t *getRawFrame(size_t index) const;
+
+    // Bytes of the frame index and decoded frames
+    size_t getMemoryUsage() const;
+    size_t getMappedSize() const;
+
+private:
+    typedef std::list<std::pair<size_t, std::shared_ptr<Csi>>> Lru;
+
+    size_t cacheSize;
+    uint32_t prefetch;
+
+    const uint8_t *mapped = nullptr;
+    size_t mappedSize = 0;
+    std::vector<uint64_t> offsets;
+
+    ProcessingPipeline pipeline;
+    std::string spec;
+    uint64_t generation = 0; // changes with file and pipeline, frames decoded for an older one are dropped
+
+    mutable std::mutex mutex;
+    std::condition_variable requested;
+    std::condition_variable decoded;
+    std::deque<size_t> requests;
+    Lru lru;
+    std::unordered_map<size_t, Lru::iterator> cached;
+    size_t cachedBytes = 0;
+    bool stopping = false;
+    bool decoding = false; // prefetcher reads the mapping without holding mutex
+    std::thread prefetcher;
+
+    std::shared_ptr<Csi> decode(const uint8_t *frame, ProcessingPipeline &pipeline) const;
+    void insert(size_t index, const std::shared_ptr<Csi> &csi);
+    void requestNeighbours(size_t index);
+    void prefetchLoop();
+};
+
+#endif
@@ -19,27 +19,28 @@
 #ifndef CSI_PROCESSOR_H
 #define CSI_PROCESSOR_H
 
+#include <ostream>
 #include <string>
 #include <vector>
 #include "Csi.h"
+#include "BatchExecutor.h"
+#include "CsiFrameStore.h"
+#include "ProcessedCache.h"
+#include "ProcessingPipeline.h"
 #include "main.h"
 
 class CsiProcessor
 {
 
 public:
-    std::vector<Csi*> csiData;
-
-    bool loadCsi();
-    void saveCsi();
+    void saveCsi(const CsiFrameStore &store);
+    void setPipeline(const std::string &spec);
+    void process(std::vector<Csi *> &batch);
     void process(Csi &csi);
+    static uint64_t writeProcessed(std::ostream &out, const Csi &csi, ProcessedCache::Writer *cacheWriter = nullptr);
 
-
-    ~CsiProcessor();
 private:
-    void clearState();
-    void interpolate(Csi &csi, enum processor type);
-    void phaseCalibLinearTransform(Csi &csi);
+    ProcessingPipeline pipeline;
 };
 
 #endif
\ No newline at end of file
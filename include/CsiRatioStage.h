@@ -0,0 +1,63 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSI_RATIO_STAGE_H
+#define CSI_RATIO_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "ProcessingStage.h"
+
+// Replaces the chains of every frame by per subcarrier products of chain pairs,
+// which cancel the random phase offsets (CFO, SFO, PDD) common to all chains
+// of one receiver. The frame then has one chain per pair (numRx = pairs,
+// numTx = 1). Frames with fewer chains than the pairs refer to are left as is.
+//
+// Params: pairs=a-b+c-d chain indices (default 0-1),
+//         mode=conj for H_a * conj(H_b) / sqrt(|H_a| |H_b|), keeping CSI magnitude scale,
+//              ratio for H_a / H_b * scale (default conj),
+//         scale=S multiplier of ratios so they survive int16 encoding (default 1024),
+//         replace saves and sends the result instead of the captured data, see Csi::encodeProcessed().
+class CsiRatioStage : public ProcessingStage
+{
+
+public:
+    enum mode
+    {
+        conjugate,
+        ratio
+    };
+
+    explicit CsiRatioStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    enum mode ratioMode = mode::conjugate;
+    double scale = 1024;
+    bool replace = false;
+    std::vector<std::complex<double>> products;
+
+    void combine(Csi &csi);
+};
+
+#endif
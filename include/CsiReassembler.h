@@ -0,0 +1,91 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CSI_REASSEMBLER_H
+#define CSI_REASSEMBLER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+#include "CsiChunk.h"
+
+#define CSI_REASSEMBLER_MAX_FRAMES 64
+#define CSI_REASSEMBLER_TIMEOUT_MS 100
+#define CSI_REASSEMBLER_MAX_FRAME_SIZE (1 << 20)
+
+// Frame of CSI header followed by CSI data, as in the .dat file
+typedef std::function<void(const uint8_t *frame, uint32_t size)> FrameSink;
+
+// Reference receiver of the chunked UDP stream. Chunks may come in any
+// order, a frame is handed to the sinks once all its chunks arrived. At most
+// maxFrames frames are buffered; when a new frame does not fit the oldest one
+// is dropped, and frames waiting longer than the timeout are dropped on
+// push() and expire(). A frame never completes when one of its chunks is
+// lost, so the timeout bounds the latency a loss adds.
+//
+// Usage: for every received datagram call push(), it returns false for
+// datagrams which are not chunks (unchunked frames, motion events, ...).
+class CsiReassembler
+{
+
+public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    CsiReassembler(uint32_t maxFrames = CSI_REASSEMBLER_MAX_FRAMES, uint32_t timeoutMs = CSI_REASSEMBLER_TIMEOUT_MS);
+
+    void addSink(const FrameSink &sink);
+    bool push(const uint8_t *datagram, size_t size, TimePoint now = std::chrono::steady_clock::now());
+    void expire(TimePoint now = std::chrono::steady_clock::now());
+    void printStatistics();
+    // Frame ids skipped without a single chunk arriving
+    uint64_t getMissingFrames() const;
+
+    uint64_t completedFrames = 0;
+    uint64_t timedOutFrames = 0;  // incomplete, dropped after timeout
+    uint64_t evictedFrames = 0;   // incomplete, dropped for a newer frame
+    uint64_t duplicateChunks = 0; // repeated or of an already finished frame
+    uint64_t invalidChunks = 0;
+
+private:
+    struct PartialFrame
+    {
+        std::vector<uint8_t> data;
+        std::vector<bool> received;
+        uint32_t remaining;
+        TimePoint firstChunk;
+    };
+
+    uint32_t maxFrames;
+    std::chrono::milliseconds timeout;
+    std::vector<FrameSink> sinks;
+
+    std::map<uint32_t, PartialFrame> frames; // by frameId
+    std::vector<std::vector<uint8_t>> spareBuffers;
+    std::vector<uint32_t> finishedIds; // ring of recently completed or dropped frames, their late chunks are ignored
+    uint32_t finishedCount = 0;
+    bool started = false;
+    uint32_t firstFrameId = 0;
+    uint32_t lastFrameId = 0; // newest id seen
+
+    void finish(std::map<uint32_t, PartialFrame>::iterator frame);
+    bool finished(uint32_t frameId) const;
+};
+
+#endif
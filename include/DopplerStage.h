@@ -0,0 +1,109 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DOPPLER_STAGE_H
+#define DOPPLER_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "Fft.h"
+#include "ProcessingStage.h"
+#include "RecordFile.h"
+
+struct __attribute__((__packed__)) DopplerHeader
+{
+    uint64_t firstTimestamp; // timestamps of the first and last frame in the window
+    uint64_t lastTimestamp;
+    uint8_t srcMac[6];
+    uint16_t numChains;
+    uint16_t numGroups;
+    uint16_t numBins;
+};
+
+// Doppler power spectrum of one window, power[(chain * numGroups + group) * numBins + bin],
+// bins are ordered from the most negative to the most positive frequency
+struct DopplerFrame
+{
+    DopplerHeader header;
+    std::vector<float> power;
+};
+
+typedef std::function<void(const DopplerFrame &frame)> DopplerSink;
+
+// Sliding window STFT of CSI over consecutive frames of every transmitter.
+// History of every (MAC, chain, subcarrier) is kept in a circular buffer, each
+// hop the window mean is removed, a Hann window applied and the power spectrum
+// averaged over groups of neighbouring subcarriers. FFTs of one hop are spread
+// over the following hop frames, so the cost per frame stays bounded.
+//
+// Params: window=N frames, power of two (default 64),
+//         hop=H frames between spectra (default 16),
+//         group=G subcarriers averaged together (default 1),
+//         output=FILE appends DopplerHeader followed by float power for every spectrum.
+//
+// Frequency axis assumes frames arrive at a constant rate, the timestamps in
+// the header give the actual rate of the window.
+class DopplerStage : public ProcessingStage
+{
+
+public:
+    explicit DopplerStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+    bool hasOutput() const override;
+
+    void addSink(const DopplerSink &sink);
+
+    uint64_t emittedFrames = 0;
+
+private:
+    struct Stream
+    {
+        uint32_t numChains = 0;
+        uint32_t numSubCarriers = 0;
+        uint64_t count = 0;
+        std::vector<std::complex<double>> history; // slot major, (window + hop) slots of every column
+        std::vector<uint64_t> timestamps;
+        bool pending = false;
+        uint64_t pendingEnd = 0; // count of the last frame in the window being transformed
+        uint32_t nextColumn = 0;
+        DopplerFrame frame;
+    };
+
+    uint32_t windowSize = 64;
+    uint32_t hop = 16;
+    uint32_t groupSize = 1;
+    const Fft *fft;
+    std::vector<double> window;
+    std::vector<std::complex<double>> buffer;
+    std::map<uint64_t, Stream> streams;
+    std::vector<DopplerSink> sinks;
+    RecordFile output;
+
+    void update(Csi &csi);
+    void transformColumns(Stream &stream, uint32_t columns);
+    void emit(Stream &stream);
+};
+
+#endif
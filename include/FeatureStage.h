@@ -0,0 +1,141 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FEATURE_STAGE_H
+#define FEATURE_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Fft.h"
+#include "ProcessingStage.h"
+#include "RecordFile.h"
+#include "SharedMemoryRing.h"
+
+// "FFEV" in little endian, record magic, see RawHeaderData in Csi.h
+#define FEATURE_VECTOR_MAGIC 0x56454646
+
+struct __attribute__((__packed__)) FeatureHeader
+{
+    uint32_t magic; // FEATURE_VECTOR_MAGIC
+    uint64_t firstTimestamp; // timestamps of the first and last frame in the window
+    uint64_t lastTimestamp;
+    uint8_t srcMac[6];
+    uint16_t numChains;
+    uint16_t numFeatures;
+};
+
+struct FeatureVector
+{
+    FeatureHeader header;
+    std::vector<float> values;
+};
+
+typedef std::function<void(const FeatureVector &vector)> FeatureSink;
+
+// Fixed size feature vector of every transmitter per window of frames.
+// Subcarriers of every chain are split into groups equal in count, so the
+// vector size only depends on the number of chains. Features in the order of
+// the features param:
+//   mean, std, kurtosis  amplitude statistics of every (chain, group), values[chain * groups + group]
+//   doppler              energy of every (chain, band) in the spectrum of group mean amplitudes over the window
+//   phase                circular mean and std of the phase difference to chain 0 of every (chain > 0, group)
+// Sums are kept per hop block, a window combines its blocks, so sliding
+// windows (hop < window) cost the same per frame as tumbling ones.
+//
+// Params: features=F+F.. (default mean+std+kurtosis+doppler+phase),
+//         groups=G subcarrier groups (default 8),
+//         window=W frames (default 64), power of two with doppler,
+//         hop=H frames between vectors, divides window (default window, tumbling),
+//         bands=a-b+c-d Doppler bins summed into every band, both signs (default 1-2+3-8+9-32),
+//         output=FILE appends FeatureHeader followed by float values,
+//         shm=NAME writes records to SharedMemoryRing /dev/shm/NAME, capacity=N records (default 1024),
+//         slots are sized by the first record, records of another size (other chain count) are skipped.
+class FeatureStage : public ProcessingStage
+{
+
+public:
+    explicit FeatureStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+    bool hasOutput() const override;
+
+    void addSink(const FeatureSink &sink);
+
+    uint64_t emittedVectors = 0;
+
+private:
+    enum feature
+    {
+        amplitudeMean,
+        amplitudeStd,
+        amplitudeKurtosis,
+        dopplerEnergy,
+        phaseDifference,
+    };
+
+    // Sums of one hop
+    struct Block
+    {
+        uint32_t frames = 0;
+        uint64_t firstTimestamp = 0;
+        std::vector<double> moments; // (chain * groups + group) * 4 + p, sum of (amplitude - shift)^(p + 1)
+        std::vector<double> phases;  // ((chain - 1) * groups + group) * 2, sum of cos and sin
+    };
+
+    struct Stream
+    {
+        uint32_t numChains = 0;
+        uint32_t numSubCarriers = 0;
+        uint64_t count = 0;
+        std::vector<uint32_t> groupStart; // groups + 1 subcarrier offsets
+        std::vector<double> shift;        // per (chain, group), keeps power sums small
+        std::vector<Block> blocks;        // window / hop blocks, circular
+        std::vector<double> series;       // group mean amplitude, (chain * groups + group) * window + slot
+        FeatureVector vector;
+    };
+
+    std::vector<enum feature> features;
+    uint32_t groups = 8;
+    uint32_t window = 64;
+    uint32_t hop = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> bands;
+    const Fft *fft = nullptr;
+    std::vector<double> hann;
+    std::vector<std::complex<double>> buffer;
+    std::map<uint64_t, Stream> streams;
+    std::vector<FeatureSink> sinks;
+    RecordFile output;
+    std::string shmName;
+    uint32_t shmCapacity = 1024;
+    std::unique_ptr<SharedMemoryRing> shm;
+
+    void update(Csi &csi);
+    void reset(Stream &stream, const Csi &csi);
+    void emit(Stream &stream, const Csi &csi);
+    void dopplerEnergies(const Stream &stream, uint32_t chain, float *energies);
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+// In-place complex FFT for power of two sizes. Plans (bit reversal
+// permutation and twiddle factors) are built once per size and shared by all
+// threads, transforms use radix-4 butterflies with one radix-2 stage when
+// log2(size) is odd.
+class Fft
+{
+
+public:
+    // Plan for size, built on first use. Throws std::invalid_argument when size is not a power of two.
+    static const Fft &get(uint32_t size);
+
+    void forward(std::complex<double> *data) const;
+    // Inverse transform scaled by 1 / size
+    void inverse(std::complex<double> *data) const;
+    uint32_t getSize() const;
+
+    explicit Fft(uint32_t size);
+
+private:
+    uint32_t size;
+    uint32_t log2Size;
+    std::vector<uint32_t> bitReverse;
+    std::vector<std::complex<double>> twiddles; // exp(-2 pi i k / size)
+
+    template <bool Inverse>
+    void transform(std::complex<double> *data) const;
+};
+
+#endif
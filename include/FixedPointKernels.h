@@ -0,0 +1,183 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FIXED_POINT_KERNELS_H
+#define FIXED_POINT_KERNELS_H
+
+#include <array>
+#include <cstdint>
+
+// Integer only kernels of the fixed point path. Samples stay int16 IQ as
+// reported by the NIC, magnitude is int32 with MAGNITUDE_FRACTION_BITS and
+// phase a binary angle, 2^16 per turn, kept in int32 so it can be unwrapped.
+// Conversions use CORDIC on four samples at a time with GCC vector types,
+// which compile to NEON on ARM and SSE on x86.
+namespace fixedPoint
+{
+    constexpr uint32_t CORDIC_ITERATIONS = 16;
+    constexpr uint32_t MAGNITUDE_FRACTION_BITS = 4;
+    constexpr int32_t CORDIC_INVERSE_GAIN_Q15 = 19898; // 1 / prod(sqrt(1 + 2^-2i))
+    constexpr int32_t PHASE_TURN = 1 << 16;
+
+    typedef int32_t Int32x4 __attribute__((vector_size(16)));
+    typedef uint32_t Uint32x4 __attribute__((vector_size(16)));
+    typedef int64_t Int64x4 __attribute__((vector_size(32)));
+
+    // atan(2^-i) as binary angle, 2^32 per turn
+    inline constexpr std::array<uint32_t, CORDIC_ITERATIONS> ATAN = {
+        0x20000000, 0x12e4051e, 0x09fb385b, 0x051111d4, 0x028b0d43, 0x0145d7e1, 0x00a2f61e, 0x00517c55,
+        0x0028be53, 0x00145f2f, 0x000a2f98, 0x000517cc, 0x00028be6, 0x000145f3, 0x0000a2fa, 0x0000517d};
+
+    // Conditional negation, mask is -1 to negate and 0 to keep
+    inline Int32x4 negateIf(Int32x4 v, Int32x4 mask)
+    {
+        return (v ^ mask) - mask;
+    }
+
+    inline Uint32x4 negateIf(Uint32x4 v, Int32x4 mask)
+    {
+        return (v ^ (Uint32x4)mask) - (Uint32x4)mask;
+    }
+
+    // Magnitude and phase of count interleaved int16 IQ samples, CORDIC vectoring mode
+    inline void toPolar(const int16_t *iq, uint32_t count, int32_t *magnitude, int32_t *phase)
+    {
+        for (uint32_t n = 0; n < count; n += 4)
+        {
+            Int32x4 x;
+            Int32x4 y;
+            for (uint32_t l = 0; l < 4; l++)
+            {
+                const uint32_t i = n + l < count ? n + l : count - 1;
+                x[l] = iq[2 * i];
+                y[l] = iq[2 * i + 1];
+            }
+
+            // Rotate the left half plane by pi, CORDIC converges for |angle| < 99 degrees
+            const Int32x4 negative = x < 0;
+            Uint32x4 z = (Uint32x4)negative & 0x80000000u;
+
+            // Q14 with the CORDIC gain compensated up front, |x|, |y| stay below 2^30
+            x = negateIf(x, negative) * CORDIC_INVERSE_GAIN_Q15 >> 1;
+            y = negateIf(y, negative) * CORDIC_INVERSE_GAIN_Q15 >> 1;
+
+            for (uint32_t i = 0; i < CORDIC_ITERATIONS; i++)
+            {
+                const Int32x4 d = y >> 31;
+                const Int32x4 dx = negateIf(y >> i, d);
+                const Int32x4 dy = negateIf(x >> i, d);
+                x += dx;
+                y -= dy;
+                z += negateIf(Uint32x4{ATAN[i], ATAN[i], ATAN[i], ATAN[i]}, d);
+            }
+
+            const Int32x4 m = (x + (1 << (13 - MAGNITUDE_FRACTION_BITS))) >> (14 - MAGNITUDE_FRACTION_BITS);
+            // Truncated, so angles just above -pi stay negative as with std::arg
+            const Int32x4 p = (Int32x4)(z >> 16);
+            for (uint32_t l = 0; l < 4 && n + l < count; l++)
+            {
+                magnitude[n + l] = m[l];
+                phase[n + l] = (int16_t)p[l];
+            }
+        }
+    }
+
+    // Interleaved int16 IQ samples from magnitude and phase, CORDIC rotation mode, saturated
+    inline void fromPolar(const int32_t *magnitude, const int32_t *phase, uint32_t count, int16_t *iq)
+    {
+        const Int64x4 high = {INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX};
+        const Int64x4 low = {INT16_MIN, INT16_MIN, INT16_MIN, INT16_MIN};
+        for (uint32_t n = 0; n < count; n += 4)
+        {
+            Int32x4 x;
+            Uint32x4 z;
+            for (uint32_t l = 0; l < 4; l++)
+            {
+                const uint32_t i = n + l < count ? n + l : count - 1;
+                x[l] = magnitude[i] < 0 ? 0 : magnitude[i];
+                z[l] = (uint32_t)phase[i] << 16;
+            }
+            x <<= 14 - MAGNITUDE_FRACTION_BITS;
+            Int32x4 y = {0, 0, 0, 0};
+
+            // Angles in the second and third quadrant start from -x and angle - pi
+            const Int32x4 flip = -(Int32x4)((z + 0x40000000u) >> 31);
+            x = negateIf(x, flip);
+            z += (Uint32x4)flip & 0x80000000u;
+
+            for (uint32_t i = 0; i < CORDIC_ITERATIONS; i++)
+            {
+                const Int32x4 d = (Int32x4)z >> 31;
+                const Int32x4 dx = negateIf(y >> i, d);
+                const Int32x4 dy = negateIf(x >> i, d);
+                x -= dx;
+                y += dy;
+                z -= negateIf(Uint32x4{ATAN[i], ATAN[i], ATAN[i], ATAN[i]}, d);
+            }
+
+            // Q14 with the CORDIC gain, the product needs 64 bits
+            Int64x4 real = (__builtin_convertvector(x, Int64x4) * CORDIC_INVERSE_GAIN_Q15 + (1 << 28)) >> 29;
+            Int64x4 imag = (__builtin_convertvector(y, Int64x4) * CORDIC_INVERSE_GAIN_Q15 + (1 << 28)) >> 29;
+            real = real > high ? high : (real < low ? low : real);
+            imag = imag > high ? high : (imag < low ? low : imag);
+            for (uint32_t l = 0; l < 4 && n + l < count; l++)
+            {
+                iq[2 * (n + l)] = real[l];
+                iq[2 * (n + l) + 1] = imag[l];
+            }
+        }
+    }
+
+    // Replaces pilots of one chain by the mean of their neighbours
+    inline void interpolatePilotsLinear(int32_t *magnitude, int32_t *phase, const uint32_t *pilots, uint32_t numPilots)
+    {
+        for (uint32_t i = 0; i < numPilots; i++)
+        {
+            const uint32_t p = pilots[i];
+            magnitude[p] = (magnitude[p - 1] + magnitude[p + 1]) >> 1;
+            phase[p] = (phase[p - 1] + phase[p + 1]) >> 1;
+        }
+    }
+
+    // Unwraps phase of one chain and subtracts the least-squares line over k.
+    // weights are (k - kMean) / sum((k - kMean)^2) in Q40, kOffsets 2 (k - kMean) rounded.
+    inline void sanitizeLinearPhase(int32_t *phase, uint32_t count, const int64_t *weights, const int32_t *kOffsets)
+    {
+        int32_t previous = phase[0];
+        int64_t sumPhase = phase[0];
+        int64_t fit = weights[0] * phase[0];
+        for (uint32_t i = 1; i < count; i++)
+        {
+            // Neighbour difference wrapped into [-pi, pi) by the int16 cast
+            const int32_t raw = phase[i];
+            phase[i] = phase[i - 1] + (int16_t)(raw - previous);
+            previous = raw;
+            sumPhase += phase[i];
+            fit += weights[i] * phase[i];
+        }
+
+        const int64_t slope = (fit + (1 << 19)) >> 20; // Q20 per k
+        const int32_t mean = sumPhase / (int64_t)count;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            phase[i] -= (int32_t)((slope * kOffsets[i] + (1 << 20)) >> 21) + mean;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FIXED_POINT_PROCESSOR_H
+#define FIXED_POINT_PROCESSOR_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Csi.h"
+#include "ProcessingPipeline.h"
+
+// Integer alternative of ProcessingPipeline for CPUs with weak floating point.
+// Frames are processed in place in their raw int16 IQ data, so they can be
+// loaded without decoding (Csi::loadFromMemory with decode false) and saved or
+// sent as they are. Supported stages are interpolateLinear and
+// phaseCalibration, with the same results as the floating point stages up to
+// rounding. Only the capture path (WiFiCsiController) uses it, offline
+// processing runs the floating point pipeline.
+//
+// With checkEvery set, every checkEvery-th frame is also run through the
+// floating point pipeline of the same spec and the difference accumulated.
+class FixedPointProcessor
+{
+
+public:
+    FixedPointProcessor() = default;
+    explicit FixedPointProcessor(const std::string &spec, uint32_t checkEvery = 0);
+
+    void process(Csi &csi);
+    bool empty() const;
+    void printStatistics();
+
+    uint64_t processedFrames = 0;
+    uint64_t processingTimeNs = 0;
+
+private:
+    enum step
+    {
+        interpolateLinear,
+        phaseCalibration,
+    };
+
+    // Fit of the phase calibration for one layout, see fixedPoint::sanitizeLinearPhase
+    struct Fit
+    {
+        std::vector<int64_t> weights;
+        std::vector<int32_t> kOffsets;
+    };
+
+    std::string spec;
+    std::vector<enum step> steps;
+    std::vector<int32_t> magnitude;
+    std::vector<int32_t> phase;
+    std::map<std::pair<const SubcarrierLayout *, uint32_t>, Fit> fits;
+
+    uint32_t checkEvery = 0;
+    std::unique_ptr<ProcessingPipeline> reference;
+    uint64_t checkedFrames = 0;
+    double maxError = 0;
+    double sumSquaredError = 0;
+    double sumSquaredSignal = 0;
+
+    const Fit &getFit(const SubcarrierLayout *layout, uint32_t n);
+    void check(const Csi &csi, const Csi &expected);
+};
+
+#endif
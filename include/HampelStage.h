@@ -0,0 +1,62 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HAMPEL_STAGE_H
+#define HAMPEL_STAGE_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "ProcessingStage.h"
+#include "RunningStatistics.h"
+
+// Causal Hampel filter of subcarrier magnitude over the last frames of every
+// transmitter. A magnitude further than threshold * 1.4826 * MAD from the
+// window median is replaced by the median, phase is kept. MAD is the sliding
+// median of deviations from the median at the time each frame arrived, which
+// keeps updates O(log window).
+//
+// Params: window=W frames (default 11), threshold=T (default 3).
+class HampelStage : public ProcessingStage
+{
+
+public:
+    explicit HampelStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+
+    uint64_t replacedValues = 0;
+
+private:
+    struct Stream
+    {
+        uint32_t numValues = 0;
+        std::vector<SlidingMedian> values;
+        std::vector<SlidingMedian> deviations;
+    };
+
+    uint32_t window = 11;
+    double threshold = 3;
+    std::map<uint64_t, Stream> streams;
+
+    void filter(Csi &csi);
+};
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INTERPOLATION_STAGE_H
+#define INTERPOLATION_STAGE_H
+
+#include "ProcessingStage.h"
+#include "main.h"
+
+// Replaces pilot subcarriers with values interpolated from their neighbours
+class InterpolationStage : public ProcessingStage
+{
+
+public:
+    explicit InterpolationStage(enum processor type);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    enum processor type;
+
+    void interpolate(Csi &csi);
+};
+
+#endif
@@ -56,6 +56,9 @@ public:
 
     void runUdpSocket();
 
+    // Headless --process mode, does not touch interfaces, returns exit code
+    static int runProcess();
+
     void initInterface();
     
     void restoreState();
@@ -0,0 +1,239 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MATRIX_KERNELS_H
+#define MATRIX_KERNELS_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// Dense kernels over row-major matrices. Loops over the long dimension are
+// split into blocks, so the block of the tall operand stays in cache while
+// every row of the other operand passes over it.
+namespace matrixKernels
+{
+    const uint32_t BLOCK_SIZE = 256;
+
+    // Plain complex products, std::complex operator* goes through the NaN/Inf checking library call
+    inline std::complex<double> multiply(const std::complex<double> &a, const std::complex<double> &b)
+    {
+        return std::complex<double>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+    }
+
+    // a * conj(b)
+    inline std::complex<double> multiplyConj(const std::complex<double> &a, const std::complex<double> &b)
+    {
+        return std::complex<double>(a.real() * b.real() + a.imag() * b.imag(), a.imag() * b.real() - a.real() * b.imag());
+    }
+
+    // p (rows x k) = (x (rows x cols) - mean) * q (cols x k)
+    inline void multiplyCentered(const double *x, const double *mean, uint32_t rows, uint32_t cols, const double *q, uint32_t k, double *p)
+    {
+        std::fill(p, p + rows * k, 0.0);
+        for (uint32_t block = 0; block < cols; block += BLOCK_SIZE)
+        {
+            const uint32_t end = std::min(cols, block + BLOCK_SIZE);
+            for (uint32_t r = 0; r < rows; r++)
+            {
+                const double *row = x + (uint64_t)r * cols;
+                double *out = p + r * k;
+                for (uint32_t c = block; c < end; c++)
+                {
+                    const double v = row[c] - mean[c];
+                    const double *qRow = q + c * k;
+                    for (uint32_t j = 0; j < k; j++)
+                    {
+                        out[j] += v * qRow[j];
+                    }
+                }
+            }
+        }
+    }
+
+    // z (cols x k) = x^T (cols x rows) * p (rows x k)
+    inline void multiplyTransposed(const double *x, uint32_t rows, uint32_t cols, const double *p, uint32_t k, double *z)
+    {
+        std::fill(z, z + cols * k, 0.0);
+        for (uint32_t block = 0; block < cols; block += BLOCK_SIZE)
+        {
+            const uint32_t end = std::min(cols, block + BLOCK_SIZE);
+            for (uint32_t r = 0; r < rows; r++)
+            {
+                const double *row = x + (uint64_t)r * cols;
+                const double *pRow = p + r * k;
+                for (uint32_t c = block; c < end; c++)
+                {
+                    double *out = z + c * k;
+                    for (uint32_t j = 0; j < k; j++)
+                    {
+                        out[j] += row[c] * pRow[j];
+                    }
+                }
+            }
+        }
+    }
+
+    // y (rows) = m x for a sparse real matrix m in CSR form, row r uses columns and weights in [offsets[r], offsets[r + 1])
+    inline void sparseMultiply(const uint32_t *offsets, const uint32_t *columns, const double *weights, uint32_t rows,
+                               const std::complex<double> *x, std::complex<double> *y)
+    {
+        for (uint32_t r = 0; r < rows; r++)
+        {
+            double real = 0;
+            double imag = 0;
+            for (uint32_t j = offsets[r]; j < offsets[r + 1]; j++)
+            {
+                real += weights[j] * x[columns[j]].real();
+                imag += weights[j] * x[columns[j]].imag();
+            }
+            y[r] = std::complex<double>(real, imag);
+        }
+    }
+
+    // Modified Gram-Schmidt on the k columns of q (rows x k), columns that vanish are left zero
+    inline void orthonormalizeColumns(double *q, uint32_t rows, uint32_t k)
+    {
+        for (uint32_t j = 0; j < k; j++)
+        {
+            for (uint32_t i = 0; i < j; i++)
+            {
+                double dot = 0;
+                for (uint32_t r = 0; r < rows; r++)
+                {
+                    dot += q[r * k + i] * q[r * k + j];
+                }
+                for (uint32_t r = 0; r < rows; r++)
+                {
+                    q[r * k + j] -= dot * q[r * k + i];
+                }
+            }
+
+            double norm = 0;
+            for (uint32_t r = 0; r < rows; r++)
+            {
+                norm += q[r * k + j] * q[r * k + j];
+            }
+            norm = std::sqrt(norm);
+            const double scale = norm > 0 ? 1 / norm : 0;
+            for (uint32_t r = 0; r < rows; r++)
+            {
+                q[r * k + j] *= scale;
+            }
+        }
+    }
+
+    // Eigendecomposition of the Hermitian n x n matrix a by cyclic Jacobi rotations.
+    // a is destroyed, eigenvalues are returned in descending order and eigenvector j
+    // is column j of vectors (row-major n x n).
+    inline void hermitianEigen(std::complex<double> *a, uint32_t n, double *eigenvalues, std::complex<double> *vectors)
+    {
+        for (uint32_t i = 0; i < n * n; i++)
+        {
+            vectors[i] = i / n == i % n ? 1.0 : 0.0;
+        }
+
+        double norm = 0;
+        for (uint32_t i = 0; i < n * n; i++)
+        {
+            norm += std::norm(a[i]);
+        }
+        const double tolerance = 1e-26 * norm;
+
+        for (uint32_t sweep = 0; sweep < 50; sweep++)
+        {
+            double offDiagonal = 0;
+            for (uint32_t p = 0; p < n; p++)
+            {
+                for (uint32_t q = p + 1; q < n; q++)
+                {
+                    offDiagonal += std::norm(a[p * n + q]);
+                }
+            }
+            if (offDiagonal <= tolerance)
+            {
+                break;
+            }
+
+            for (uint32_t p = 0; p < n; p++)
+            {
+                for (uint32_t q = p + 1; q < n; q++)
+                {
+                    const std::complex<double> apq = a[p * n + q];
+                    const double magnitude = std::abs(apq);
+                    if (magnitude * magnitude <= tolerance / (n * n))
+                    {
+                        continue;
+                    }
+
+                    // Phase e moves a[p][q] to the real axis, then a real rotation by theta zeroes it.
+                    // Rotation columns are p = (c, -s conj(e)), q = (s, c conj(e)).
+                    const std::complex<double> e = apq / magnitude;
+                    const double theta = 0.5 * std::atan2(2 * magnitude, a[q * n + q].real() - a[p * n + p].real());
+                    const double c = std::cos(theta);
+                    const double s = std::sin(theta);
+                    const std::complex<double> se = s * std::conj(e);
+                    const std::complex<double> ce = c * std::conj(e);
+
+                    for (uint32_t k = 0; k < n; k++)
+                    {
+                        const std::complex<double> akp = a[k * n + p];
+                        const std::complex<double> akq = a[k * n + q];
+                        a[k * n + p] = c * akp - multiply(se, akq);
+                        a[k * n + q] = s * akp + multiply(ce, akq);
+
+                        const std::complex<double> vkp = vectors[k * n + p];
+                        const std::complex<double> vkq = vectors[k * n + q];
+                        vectors[k * n + p] = c * vkp - multiply(se, vkq);
+                        vectors[k * n + q] = s * vkp + multiply(ce, vkq);
+                    }
+                    for (uint32_t k = 0; k < n; k++)
+                    {
+                        const std::complex<double> apk = a[p * n + k];
+                        const std::complex<double> aqk = a[q * n + k];
+                        a[p * n + k] = c * apk - multiplyConj(aqk, se);
+                        a[q * n + k] = s * apk + multiplyConj(aqk, ce);
+                    }
+                    a[p * n + q] = 0;
+                    a[q * n + p] = 0;
+                }
+            }
+        }
+
+        std::vector<uint32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [a, n](uint32_t x, uint32_t y)
+                  { return a[x * n + x].real() > a[y * n + y].real(); });
+
+        std::vector<std::complex<double>> sorted(n * n);
+        for (uint32_t j = 0; j < n; j++)
+        {
+            eigenvalues[j] = a[order[j] * n + order[j]].real();
+            for (uint32_t k = 0; k < n; k++)
+            {
+                sorted[k * n + j] = vectors[k * n + order[j]];
+            }
+        }
+        std::copy(sorted.begin(), sorted.end(), vectors);
+    }
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOTION_STAGE_H
+#define MOTION_STAGE_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "ProcessingStage.h"
+#include "RecordFile.h"
+#include "RunningStatistics.h"
+
+// "FMEV" in little endian, record magic, see RawHeaderData in Csi.h
+#define MOTION_EVENT_MAGIC 0x56454d46
+
+enum motionEvent : uint8_t
+{
+    motionLevel,
+    presenceOn,
+    presenceOff,
+};
+
+struct __attribute__((__packed__)) MotionEvent
+{
+    uint32_t magic; // MOTION_EVENT_MAGIC
+    uint64_t timestamp;
+    uint8_t srcMac[6];
+    uint8_t type; // motionEvent
+    uint8_t present;
+    float level;
+    float variance;    // mean over subcarriers of normalized amplitude variance in the window
+    float correlation; // mean correlation of consecutive amplitude vectors in the window
+};
+
+typedef std::function<void(const MotionEvent &event)> MotionSink;
+
+// Motion and presence detection for every transmitter. Amplitudes are
+// normalized by their frame mean, so AGC steps do not count as motion. Two
+// features are kept over a sliding window: the mean variance of normalized
+// amplitude per subcarrier and the mean correlation of consecutive amplitude
+// vectors. Motion level is the larger of the standard deviation and the
+// decorrelation (1 - correlation). Presence turns on when level reaches on
+// and off when level stays below off for hold frames.
+//
+// Params: window=W frames (default 50),
+//         on=L level turning presence on (default 0.05), off=L (default 0.03),
+//         hold=N frames below off before presence off (default 100),
+//         every=N frames between motion level events, 0 only sends presence changes (default 10),
+//         output=FILE appends MotionEvent records.
+class MotionStage : public ProcessingStage
+{
+
+public:
+    explicit MotionStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+    bool hasOutput() const override;
+
+    void addSink(const MotionSink &sink);
+
+    uint64_t emittedEvents = 0;
+
+private:
+    struct Stream
+    {
+        uint32_t numValues = 0;
+        uint64_t count = 0;
+        std::vector<SlidingMoments> moments;
+        std::vector<double> previous;
+        SlidingMoments correlation;
+        bool present = false;
+        uint32_t quietFrames = 0;
+    };
+
+    uint32_t window = 50;
+    double on = 0.05;
+    double off = 0.03;
+    uint32_t hold = 100;
+    uint32_t every = 10;
+    std::map<uint64_t, Stream> streams;
+    std::vector<double> normalized;
+    std::vector<MotionSink> sinks;
+    RecordFile output;
+
+    void update(Csi &csi);
+    void emit(const Csi &csi, enum motionEvent type, const Stream &stream, double level, double variance);
+};
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSIC_STAGE_H
+#define MUSIC_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+#include "ProcessingStage.h"
+
+// Joint angle of arrival and time of flight estimation (SpotFi) into Csi::paths.
+// CSI of the first TX stream is taken on RX antennas and a uniformly spaced
+// subset of subcarriers, smoothed over antenna and subcarrier subarrays and
+// its covariance decomposed by a Jacobi eigensolver. The MUSIC pseudo spectrum
+// 1 / |noise subspace^H a(aoa, tof)|^2 is searched on a coarse grid with
+// steering vectors precomputed per layout, peaks are then refined locally.
+//
+// Params: subcarriers=N used subcarriers (default 32), length=L subcarriers of a subarray (default 16),
+//         paths=P signal paths, 0 estimates them from eigenvalues (default 0),
+//         spacing=D antenna spacing in wavelengths (default 0.5),
+//         aoaStep=DEG coarse grid step (default 2), tofPoints=T coarse grid size (default 100),
+//         threads=T frames of a batch processed in parallel (default 1).
+//
+// ToF is relative, phase calibration before this stage removes the common offset.
+class MusicStage : public ProcessingStage
+{
+
+public:
+    explicit MusicStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    struct Plan
+    {
+        uint32_t antennas; // antennas of a subarray
+        uint32_t antennaShifts;
+        std::vector<uint32_t> positions; // used subcarriers
+        double toneSpacing;              // Hz between used subcarriers
+        std::vector<double> aoaGrid;     // degrees
+        std::vector<double> tofGrid;     // seconds
+        std::vector<std::complex<double>> aoaSteering; // aoaGrid x antennas
+        std::vector<std::complex<double>> tofSteering; // tofGrid x length
+    };
+
+    struct Workspace
+    {
+        std::vector<std::complex<double>> covariance;
+        std::vector<std::complex<double>> vectors;
+        std::vector<double> eigenvalues;
+        std::vector<std::complex<double>> signal; // paths x dimension, conjugated
+        std::vector<std::complex<double>> partial;
+        std::vector<std::complex<double>> aoaVector;
+        std::vector<std::complex<double>> tofVector;
+        std::vector<double> spectrum;
+    };
+
+    uint32_t numSubCarriers = 32;
+    uint32_t length = 16;
+    uint32_t paths = 0;
+    double spacing = 0.5;
+    double aoaStep = 2;
+    uint32_t tofPoints = 100;
+    uint32_t threads = 1;
+    std::map<std::pair<const SubcarrierLayout *, uint32_t>, Plan> plans;
+    std::vector<Workspace> workspaces;
+
+    const Plan *getPlan(const Csi &csi);
+    void estimate(Csi &csi, const Plan &plan, Workspace &workspace) const;
+    double evaluate(const Plan &plan, Workspace &workspace, uint32_t numPaths, double aoa, double tof) const;
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PCA_STAGE_H
+#define PCA_STAGE_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+#include "ProcessingStage.h"
+#include "RecordFile.h"
+
+struct __attribute__((__packed__)) PcaHeader
+{
+    uint64_t timestamp;
+    uint8_t srcMac[6];
+    uint16_t numComponents;
+};
+
+// Projection of one frame onto the principal components of its transmitter
+struct PcaFrame
+{
+    PcaHeader header;
+    std::vector<float> components;
+};
+
+typedef std::function<void(const PcaFrame &frame)> PcaSink;
+
+// Principal components of subcarrier magnitude (all chains together) over the
+// last window frames of every transmitter. The top components are refined by
+// block power iteration over the window every hop frames, warm started from
+// the previous basis, so the covariance matrix is never formed. Every frame
+// is projected onto the current basis and emitted as the component time series.
+//
+// Params: window=W frames (default 128), components=K (default 3), hop=H frames
+//         between basis updates (default 8), iterations=I per update (default 1),
+//         output=FILE appends PcaHeader followed by K float components per frame.
+class PcaStage : public ProcessingStage
+{
+
+public:
+    explicit PcaStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+    bool hasOutput() const override;
+
+    void addSink(const PcaSink &sink);
+
+private:
+    struct Stream
+    {
+        uint32_t numValues = 0;
+        uint64_t count = 0;
+        std::vector<double> rows; // window x numValues ring of magnitudes
+        std::vector<double> sum;
+        std::vector<double> mean;
+        std::vector<double> basis; // numValues x K
+        std::vector<double> projected; // window x K
+        bool hasBasis = false;
+        PcaFrame frame;
+    };
+
+    uint32_t window = 128;
+    uint32_t components = 3;
+    uint32_t hop = 8;
+    uint32_t iterations = 1;
+    std::map<uint64_t, Stream> streams;
+    std::vector<PcaSink> sinks;
+    RecordFile output;
+
+    void update(Csi &csi);
+    void updateBasis(Stream &stream, uint32_t iterations);
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PHASE_SANITIZER_H
+#define PHASE_SANITIZER_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "ProcessingStage.h"
+
+// Removes the linear phase error (STO/SFO slope and CFO offset) from every
+// RX/TX chain. Phase is unwrapped across subcarriers and a least-squares line
+// over the logical subcarrier index k is subtracted.
+// WiFi-Based Real-Time Calibration-Free Passive Human Motion Detection
+class PhaseSanitizer : public ProcessingStage
+{
+
+public:
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    void process(Csi &csi);
+
+private:
+    struct FallbackLayout
+    {
+        std::vector<int16_t> k;
+        SubcarrierLayout layout;
+    };
+
+    std::map<uint32_t, FallbackLayout> fallbackLayouts;
+    std::vector<double> corrections;
+
+    const SubcarrierLayout &getLayout(const Csi &csi);
+};
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROCESSED_CACHE_H
+#define PROCESSED_CACHE_H
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include "CsiFrameStore.h"
+
+// "FPCE" in little endian
+#define PROCESSED_CACHE_MAGIC 0x45435046
+// Part of the key, bumped when CsiProcessor::writeProcessed output changes so older entries miss
+#define PROCESSED_CACHE_FORMAT 2
+
+// Start of a cache entry file, followed by the key and dataSize bytes of processed output
+struct __attribute__((__packed__)) ProcessedCacheHeader
+{
+    uint32_t magic;
+    uint32_t keyLength;
+    uint64_t dataSize;
+};
+
+// On disk cache of processed output. An entry is keyed by the input file
+// (size, modification time and frame index), the pipeline spec and the
+// program version, so changing any of them is a miss. Hits are mapped and
+// copied to the output. When the directory grows over maxBytes the least
+// recently used entries are removed. A hit runs no stage, so pipelines
+// writing records elsewhere (ProcessingPipeline::hasOutput()) must not use
+// the cache.
+class ProcessedCache
+{
+
+public:
+    // Processed output written to a temporary file, becomes an entry on commit()
+    class Writer
+    {
+
+    public:
+        Writer(ProcessedCache &cache, const std::string &key);
+        ~Writer();
+        Writer(const Writer &) = delete;
+        Writer &operator=(const Writer &) = delete;
+
+        void write(const char *data, size_t size);
+        void commit();
+
+    private:
+        ProcessedCache &cache;
+        std::string key;
+        std::string temporaryPath;
+        std::ofstream file;
+        uint64_t dataSize = 0;
+        bool committed = false;
+    };
+
+    // Empty directory uses $XDG_CACHE_HOME/FeitCSI or ~/.cache/FeitCSI
+    ProcessedCache(const std::string &directory, uint64_t maxBytes);
+
+    static std::string makeKey(const std::string &inputFile, const CsiFrameStore &store, const std::string &pipelineSpec);
+
+    // Appends the cached output to out, returns false on miss
+    bool serve(const std::string &key, std::ostream &out, uint64_t &bytes);
+    void evict();
+
+private:
+    std::string directory;
+    uint64_t maxBytes;
+
+    std::string entryPath(const std::string &key) const;
+};
+
+#endif
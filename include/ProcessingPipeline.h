@@ -0,0 +1,68 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROCESSING_PIPELINE_H
+#define PROCESSING_PIPELINE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ProcessingStage.h"
+#include "main.h"
+
+// Ordered list of processing stages built once from a spec string such as
+// "interpolateCubic,phaseCalibration". Stage parameters follow the stage name
+// separated by colons, e.g. "stage:key=value:key=value".
+//
+// Frames are processed in place. Csi::processedKey records which stages a
+// frame went through, so a frame already processed by the same pipeline is
+// not touched again, a frame processed by a prefix of it only runs the
+// remaining stages and anything else is reset to raw CSI first.
+class ProcessingPipeline
+{
+
+public:
+    ProcessingPipeline() = default;
+    explicit ProcessingPipeline(const std::string &spec);
+
+    static std::string specFromProcessors(const std::map<enum processor, bool> &processors);
+
+    void process(std::vector<Csi *> &batch);
+    void process(std::vector<Csi *> &batch, uint32_t first, uint32_t last);
+    void process(Csi &csi);
+    bool empty() const;
+    bool hasOutput() const;
+    uint64_t getKey() const;
+    uint32_t getSequentialStart() const;
+    const std::string &getSpec() const;
+    const std::vector<std::unique_ptr<ProcessingStage>> &getStages() const;
+    void printStatistics();
+
+private:
+    std::string spec;
+    std::vector<std::unique_ptr<ProcessingStage>> stages;
+    std::vector<uint64_t> stageKeys;
+    std::vector<Csi *> singleFrame;
+    std::vector<Csi *> pending;
+
+    static std::unique_ptr<ProcessingStage> createStage(const std::string &name, const StageParams &params);
+    static uint64_t hashSpec(const std::string &spec);
+};
+
+#endif
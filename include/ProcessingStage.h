@@ -0,0 +1,51 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROCESSING_STAGE_H
+#define PROCESSING_STAGE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Csi.h"
+
+typedef std::map<std::string, std::string> StageParams;
+
+// One step of ProcessingPipeline. Stages are configured once when the pipeline
+// is built and then modify a batch of frames in place.
+class ProcessingStage
+{
+
+public:
+    virtual ~ProcessingStage() = default;
+
+    virtual const char *name() const = 0;
+    virtual void process(std::vector<Csi *> &batch) = 0;
+    // Stages keeping state across frames have to see every frame once, in capture order, on a single instance
+    virtual bool isSequential() const { return false; }
+    // Writes records outside the frames, e.g. output=FILE or shm=NAME
+    virtual bool hasOutput() const { return false; }
+
+    void run(std::vector<Csi *> &batch);
+
+    uint64_t processedFrames = 0;
+    uint64_t processingTimeNs = 0;
+};
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RECORD_FILE_H
+#define RECORD_FILE_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+// Output file of a stage, output=FILE. Records are appended, the file is
+// opened on the first one, so pipelines built only to check a spec or by
+// workers which never run the stage leave no file behind.
+class RecordFile
+{
+
+public:
+    RecordFile() = default;
+    // Fails if the directory of path does not exist
+    explicit RecordFile(const std::string &path);
+
+    bool isSet() const;
+    void write(const void *data, size_t size);
+    void write(const void *header, size_t headerSize, const void *payload, size_t payloadSize);
+
+private:
+    std::string path;
+    std::ofstream stream;
+};
+
+#endif
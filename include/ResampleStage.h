@@ -0,0 +1,66 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RESAMPLE_STAGE_H
+#define RESAMPLE_STAGE_H
+
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "ProcessingStage.h"
+
+// Resamples every chain onto one fixed subcarrier grid, so frames of any
+// format and channel width end up with the same shape. The target grid has
+// bins tones at spacing kHz centred on the carrier. Target tones finer than
+// the source are linearly interpolated from the two nearest reported tones,
+// coarser ones average all reported tones inside the target tone. Tones
+// outside of the reported band are zero. Every source layout gets its own
+// sparse resampling matrix, built once. Resampled frames get a layout of the
+// target grid (logical k = -bins / 2 .. bins / 2 - 1, no pilots).
+//
+// Params: bins=N (default 64), spacing=kHz (default 312.5).
+class ResampleStage : public ProcessingStage
+{
+
+public:
+    explicit ResampleStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+
+private:
+    // CSR resampling matrix, bins rows x reported subcarriers columns
+    struct Matrix
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> columns;
+        std::vector<double> weights;
+    };
+
+    uint32_t bins = 64;
+    double spacing = 312.5e3;
+    const SubcarrierLayout *targetLayout;
+    std::map<const SubcarrierLayout *, Matrix> matrices;
+    std::vector<std::complex<double>> resampled;
+
+    const Matrix &getMatrix(const SubcarrierLayout &layout);
+    void resample(Csi &csi);
+};
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RUNNING_STATISTICS_H
+#define RUNNING_STATISTICS_H
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+// Mean and variance of the last window values, Welford updates for the
+// value entering and the value leaving the window
+class SlidingMoments
+{
+
+public:
+    explicit SlidingMoments(uint32_t window = 1);
+
+    void push(double value);
+    double mean() const;
+    double variance() const;
+    uint32_t size() const;
+
+private:
+    std::vector<double> values;
+    uint32_t next = 0;
+    uint32_t count = 0;
+    double runningMean = 0;
+    double m2 = 0;
+};
+
+// Median of the last window values in O(log window) per push. Values are kept
+// in two ordered halves, low holds the median and everything below it.
+class SlidingMedian
+{
+
+public:
+    explicit SlidingMedian(uint32_t window = 1);
+
+    void push(double value);
+    double median() const;
+    uint32_t size() const;
+
+private:
+    std::vector<double> values;
+    uint32_t next = 0;
+    uint32_t count = 0;
+    std::multiset<double> low;
+    std::multiset<double> high;
+
+    void erase(double value);
+    void rebalance();
+};
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHAPE_KERNELS_H
+#define SHAPE_KERNELS_H
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include "SubcarrierLayout.h"
+
+// Processing kernels written once over a frame shape (number of RX/TX chains
+// and subcarriers per chain). dispatch() selects a FixedShape for the shapes
+// the NICs report, so loops get compile-time trip counts, and a DynamicShape
+// for anything else.
+namespace shapeKernels
+{
+    template <uint32_t C, uint32_t N>
+    struct FixedShape
+    {
+        static constexpr uint32_t chains() { return C; }
+        static constexpr uint32_t subcarriers() { return N; }
+    };
+
+    struct DynamicShape
+    {
+        uint32_t numChains;
+        uint32_t numSubCarriers;
+        uint32_t chains() const { return numChains; }
+        uint32_t subcarriers() const { return numSubCarriers; }
+    };
+
+    template <uint32_t C, class Kernel>
+    inline void dispatchSubcarriers(uint32_t subcarriers, Kernel &&kernel)
+    {
+        switch (subcarriers)
+        {
+        case 52:
+            return kernel(FixedShape<C, 52>());
+        case 56:
+            return kernel(FixedShape<C, 56>());
+        case 114:
+            return kernel(FixedShape<C, 114>());
+        case 242:
+            return kernel(FixedShape<C, 242>());
+        case 484:
+            return kernel(FixedShape<C, 484>());
+        case 996:
+            return kernel(FixedShape<C, 996>());
+        case 1992:
+            return kernel(FixedShape<C, 1992>());
+        default:
+            return kernel(DynamicShape{C, subcarriers});
+        }
+    }
+
+    // Calls kernel(shape) once with the most specific shape for the frame
+    template <class Kernel>
+    inline void dispatch(uint32_t chains, uint32_t subcarriers, Kernel &&kernel)
+    {
+        switch (chains)
+        {
+        case 1:
+            return dispatchSubcarriers<1>(subcarriers, kernel);
+        case 2:
+            return dispatchSubcarriers<2>(subcarriers, kernel);
+        case 4:
+            return dispatchSubcarriers<4>(subcarriers, kernel);
+        default:
+            return kernel(DynamicShape{chains, subcarriers});
+        }
+    }
+
+    // Multiple of 2 pi bringing a neighbour phase difference back into [-pi, pi],
+    // branch free so it vectorizes. Phases are expected to come from std::arg.
+    inline double wrapCorrection(double d)
+    {
+        const double twoPi = 2 * M_PI;
+        return (d > M_PI ? -twoPi : 0.0) + (d < -M_PI ? twoPi : 0.0);
+    }
+
+    // Unwraps phase of every chain along subcarriers, correction needs subcarriers() elements
+    template <class Shape>
+    inline void unwrap(const Shape &shape, double *phase, double *correction)
+    {
+        for (uint32_t c = 0; c < shape.chains(); c++)
+        {
+            double *p = phase + c * shape.subcarriers();
+
+            // Wrap correction of every neighbour difference, independent per element
+            correction[0] = 0;
+            for (uint32_t i = 1; i < shape.subcarriers(); i++)
+            {
+                correction[i] = wrapCorrection(p[i] - p[i - 1]);
+            }
+
+            double cumulative = 0;
+            for (uint32_t i = 0; i < shape.subcarriers(); i++)
+            {
+                cumulative += correction[i];
+                p[i] += cumulative;
+            }
+        }
+    }
+
+    // Unwraps every chain and subtracts the least-squares line over logical subcarrier index k
+    template <class Shape>
+    inline void sanitizeLinearPhase(const Shape &shape, double *phase, double *correction, const SubcarrierLayout &layout)
+    {
+        const int16_t *k = layout.k;
+        const double kMean = layout.kMean;
+        for (uint32_t c = 0; c < shape.chains(); c++)
+        {
+            double *p = phase + c * shape.subcarriers();
+
+            correction[0] = 0;
+            for (uint32_t i = 1; i < shape.subcarriers(); i++)
+            {
+                correction[i] = wrapCorrection(p[i] - p[i - 1]);
+            }
+
+            // Prefix sum of corrections gives unwrapped phase, fit sums are gathered on the way
+            double cumulative = 0;
+            double sumPhase = 0;
+            double sumKPhase = 0;
+            for (uint32_t i = 0; i < shape.subcarriers(); i++)
+            {
+                cumulative += correction[i];
+                p[i] += cumulative;
+                sumPhase += p[i];
+                sumKPhase += (k[i] - kMean) * p[i];
+            }
+
+            const double a = sumKPhase * layout.kInvSumSquares;
+            const double meanPhase = sumPhase / shape.subcarriers();
+            for (uint32_t i = 0; i < shape.subcarriers(); i++)
+            {
+                p[i] -= a * (k[i] - kMean) + meanPhase;
+            }
+        }
+    }
+
+    // Replaces pilots of every chain, interpolate(values, index) returns the new value at index
+    template <class Shape, class Interpolate>
+    inline void interpolatePilots(const Shape &shape, double *magnitude, double *phase, const uint32_t *pilots, uint32_t numPilots, Interpolate &&interpolate)
+    {
+        for (uint32_t c = 0; c < shape.chains(); c++)
+        {
+            double *m = magnitude + c * shape.subcarriers();
+            double *p = phase + c * shape.subcarriers();
+            for (uint32_t i = 0; i < numPilots; i++)
+            {
+                m[pilots[i]] = interpolate(m, pilots[i]);
+                p[pilots[i]] = interpolate(p, pilots[i]);
+            }
+        }
+    }
+
+    // Replaces targets of every chain with weighted sums of other subcarriers of the same chain,
+    // target t uses sources and weights in [offsets[t], offsets[t + 1])
+    template <class Shape>
+    inline void applyStencil(const Shape &shape, std::complex<double> *csi, const uint32_t *targets, uint32_t numTargets,
+                             const uint32_t *offsets, const uint32_t *sources, const double *weights)
+    {
+        for (uint32_t c = 0; c < shape.chains(); c++)
+        {
+            std::complex<double> *x = csi + c * shape.subcarriers();
+            for (uint32_t t = 0; t < numTargets; t++)
+            {
+                double real = 0;
+                double imag = 0;
+                for (uint32_t j = offsets[t]; j < offsets[t + 1]; j++)
+                {
+                    real += weights[j] * x[sources[j]].real();
+                    imag += weights[j] * x[sources[j]].imag();
+                }
+                x[targets[t]] = std::complex<double>(real, imag);
+            }
+        }
+    }
+
+    template <class Shape>
+    inline void polarToComplex(const Shape &shape, const double *magnitude, const double *phase, std::complex<double> *csi)
+    {
+        const uint32_t size = shape.chains() * shape.subcarriers();
+        for (uint32_t i = 0; i < size; i++)
+        {
+            csi[i] = std::complex<double>(magnitude[i] * std::cos(phase[i]), magnitude[i] * std::sin(phase[i]));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHARED_MEMORY_RING_H
+#define SHARED_MEMORY_RING_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// "FSHM" in little endian
+#define SHARED_MEMORY_RING_MAGIC 0x4d485346
+
+// Start of the shared memory object, slots of SharedMemoryRing::slotStride(slotSize) bytes follow
+struct SharedMemoryRingHeader
+{
+    uint32_t magic;
+    uint32_t slotSize;
+    uint32_t capacity;
+    uint32_t reserved;
+    std::atomic<uint64_t> written; // records written so far, record n is in slot n % capacity
+};
+
+// Start of every slot, the record of slotSize bytes follows. Seqlock of the
+// slot: 2n + 1 while record n is copied in, 2n + 2 once it is complete.
+struct SharedMemoryRingSlot
+{
+    std::atomic<uint64_t> sequence;
+};
+
+// Single writer ring of fixed size records in POSIX shared memory (/dev/shm/NAME).
+// The writer never waits for readers. A reader remembers how many records it
+// consumed and reads record n once written > n, see SharedMemoryRingReader.
+class SharedMemoryRing
+{
+
+public:
+    SharedMemoryRing(const std::string &name, uint32_t slotSize, uint32_t capacity);
+    ~SharedMemoryRing();
+
+    SharedMemoryRing(const SharedMemoryRing &) = delete;
+    SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+
+    void write(const void *data, uint32_t size);
+    uint32_t getSlotSize() const;
+
+    static size_t slotStride(uint32_t slotSize);
+
+private:
+    std::string name;
+    size_t mappedSize;
+    SharedMemoryRingHeader *header;
+    uint8_t *slots;
+};
+
+// Read only view of a SharedMemoryRing, possibly from another process.
+// read() copies record n and checks the slot sequence before and after the
+// copy, so a record overwritten meanwhile is never returned torn.
+class SharedMemoryRingReader
+{
+
+public:
+    explicit SharedMemoryRingReader(const std::string &name);
+    ~SharedMemoryRingReader();
+
+    SharedMemoryRingReader(const SharedMemoryRingReader &) = delete;
+    SharedMemoryRingReader &operator=(const SharedMemoryRingReader &) = delete;
+
+    // False if record n is not written yet or was overwritten, tell them apart by getWritten()
+    bool read(uint64_t n, void *out) const;
+    uint64_t getWritten() const;
+    uint32_t getSlotSize() const;
+    uint32_t getCapacity() const;
+
+private:
+    size_t mappedSize;
+    const SharedMemoryRingHeader *header;
+    const uint8_t *slots;
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATISTICS_STAGE_H
+#define STATISTICS_STAGE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "ProcessingStage.h"
+#include "RecordFile.h"
+#include "RunningStatistics.h"
+
+struct __attribute__((__packed__)) StatisticsHeader
+{
+    uint64_t timestamp;
+    uint8_t srcMac[6];
+    uint16_t numChains;
+    uint16_t numSubCarriers;
+    uint16_t numFrames; // frames currently in the window
+};
+
+// Statistics of one subcarrier magnitude over the window
+struct SubcarrierStatistics
+{
+    float mean;
+    float variance;
+    float median;
+    float ema;
+};
+
+// Running per subcarrier statistics of magnitude for every transmitter:
+// sliding window mean and variance (Welford), sliding median and an
+// exponential moving average. State is updated incrementally with every frame.
+//
+// Params: window=W frames (default 100), alpha=A EMA weight of the new frame (default 0.1),
+//         output=FILE appends StatisticsHeader followed by SubcarrierStatistics of every subcarrier,
+//         every=N frames of a transmitter between records written to output (default 1).
+class StatisticsStage : public ProcessingStage
+{
+
+public:
+    explicit StatisticsStage(const StageParams &params);
+
+    const char *name() const override;
+    void process(std::vector<Csi *> &batch) override;
+    bool isSequential() const override;
+    bool hasOutput() const override;
+
+    // Latest statistics of transmitter, nullptr when no frame was seen
+    const std::vector<SubcarrierStatistics> *getStatistics(uint64_t mac) const;
+
+private:
+    struct Stream
+    {
+        uint32_t numValues = 0;
+        uint64_t count = 0;
+        std::vector<SlidingMoments> moments;
+        std::vector<SlidingMedian> medians;
+        std::vector<SubcarrierStatistics> statistics;
+    };
+
+    uint32_t window = 100;
+    double alpha = 0.1;
+    uint32_t every = 1;
+    std::map<uint64_t, Stream> streams;
+    RecordFile output;
+
+    void update(Csi &csi);
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STREAM_SERVER_H
+#define STREAM_SERVER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define STREAM_SERVER_QUEUE_FRAMES 1024
+#define STREAM_SERVER_MAX_EVENTS 64
+
+// Reliable alternative to UDP for recording on another host. Clients
+// connect over TCP ("[HOST:]PORT") or a Unix domain socket ("unix:PATH")
+// and receive every captured CSI frame as CSI header followed by CSI data,
+// exactly as in the .dat file. The header starts with csiDataSize, so
+// records are length prefixed and a client can write the stream straight
+// to disk. A frame is copied once and shared by the queues of all clients.
+// Sockets are non-blocking and written by a thread waiting on epoll, a
+// client which does not keep up fills its queue of maxQueue frames and the
+// overflow policy decides whether its oldest frames are dropped, it is
+// disconnected or capture waits for it.
+class StreamServer
+{
+
+public:
+    enum overflow
+    {
+        dropOldest,
+        disconnect,
+        block
+    };
+
+    StreamServer(const std::string &address, uint32_t maxQueue = STREAM_SERVER_QUEUE_FRAMES, enum overflow policy = overflow::dropOldest);
+    ~StreamServer();
+    StreamServer(const StreamServer &) = delete;
+    StreamServer &operator=(const StreamServer &) = delete;
+
+    // Frame of header followed by payload, copied
+    void send(const void *header, size_t headerSize, const void *payload, size_t payloadSize);
+    size_t getClientCount();
+    void printStatistics();
+
+    static enum overflow parseOverflow(const std::string &name);
+
+private:
+    typedef std::shared_ptr<const std::vector<uint8_t>> Frame;
+
+    struct Client
+    {
+        int fd;
+        uint64_t id; // sequence number in the high and fd in the low 32 bits, epoll event data
+        std::string name;
+        std::deque<Frame> queue;
+        size_t offset = 0; // sent bytes of queue.front()
+        bool waitingWritable = false;
+        uint64_t sentFrames = 0;
+        uint64_t droppedFrames = 0;
+    };
+
+    uint32_t maxQueue;
+    enum overflow policy;
+    std::string unixPath;
+    int listenFd = -1;
+    int epollFd = -1;
+    int wakeFd = -1;
+
+    std::mutex mutex;
+    std::condition_variable writable;
+    std::map<int, Client> clients;
+    uint32_t nextClientId = 0;
+    bool stopping = false;
+    std::thread server;
+
+    uint64_t sentFrames = 0;
+    uint64_t droppedFrames = 0;
+    uint64_t disconnectedClients = 0;
+    uint64_t blockedSends = 0;
+
+    void listen(const std::string &address);
+    void serve();
+    void accept();
+    void write(Client &client);
+    void closeClient(int fd, const char *reason);
+};
+
+#endif
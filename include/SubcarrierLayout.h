@@ -0,0 +1,201 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SUBCARRIER_LAYOUT_H
+#define SUBCARRIER_LAYOUT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "rs.h"
+
+// Inclusive range of logical subcarrier indices k
+struct ToneRange
+{
+    int16_t first;
+    int16_t last;
+};
+
+// Description of the subcarriers reported by the NIC for one (format, channel width)
+struct SubcarrierLayout
+{
+    uint32_t format;
+    uint32_t channelWidth;
+    uint32_t fftSize;
+    uint32_t numSubCarriers;
+    const int16_t *k;         // logical subcarrier index of every reported subcarrier
+    const uint32_t *pilots;   // positions of pilots in the reported subcarriers
+    uint32_t numPilots;
+    const ToneRange *nulls;   // DC and inner null tones between the first and last reported k
+    uint32_t numNulls;
+    uint32_t firmwareGapStart;  // reported subcarriers dropped by Csi::fixCsiBug
+    uint32_t firmwareGapLength;
+    double kMean;
+    double kInvSumSquares;    // 1 / sum((k - kMean)^2)
+};
+
+namespace subcarrierLayout
+{
+    template <size_t N, size_t R>
+    constexpr std::array<int16_t, N> toneIndices(const std::array<ToneRange, R> &tones)
+    {
+        std::array<int16_t, N> k{};
+        size_t i = 0;
+        for (const ToneRange &range : tones)
+        {
+            for (int v = range.first; v <= range.last; v++)
+            {
+                k[i++] = (int16_t)v;
+            }
+        }
+        return k;
+    }
+
+    template <size_t R>
+    constexpr size_t toneCount(const std::array<ToneRange, R> &tones)
+    {
+        size_t count = 0;
+        for (const ToneRange &range : tones)
+        {
+            count += range.last - range.first + 1;
+        }
+        return count;
+    }
+
+    template <size_t R>
+    constexpr std::array<ToneRange, R - 1> nullRanges(const std::array<ToneRange, R> &tones)
+    {
+        std::array<ToneRange, R - 1> nulls{};
+        for (size_t i = 1; i < R; i++)
+        {
+            nulls[i - 1] = {(int16_t)(tones[i - 1].last + 1), (int16_t)(tones[i].first - 1)};
+        }
+        return nulls;
+    }
+
+    template <size_t N>
+    constexpr double mean(const std::array<int16_t, N> &k)
+    {
+        double sum = 0;
+        for (int16_t v : k)
+        {
+            sum += v;
+        }
+        return sum / N;
+    }
+
+    template <size_t N>
+    constexpr double invSumSquares(const std::array<int16_t, N> &k)
+    {
+        const double m = mean(k);
+        double sum = 0;
+        for (int16_t v : k)
+        {
+            sum += (v - m) * (v - m);
+        }
+        return 1 / sum;
+    }
+
+    template <size_t N, size_t P, size_t Z>
+    constexpr SubcarrierLayout make(uint32_t format, uint32_t channelWidth, uint32_t fftSize,
+                                    const std::array<int16_t, N> &k, const std::array<uint32_t, P> &pilots,
+                                    const std::array<ToneRange, Z> &nulls, uint32_t firmwareGapStart = 0, uint32_t firmwareGapLength = 0)
+    {
+        return {format, channelWidth, fftSize, (uint32_t)N, k.data(), pilots.data(), (uint32_t)P, nulls.data(), (uint32_t)Z,
+                firmwareGapStart, firmwareGapLength, mean(k), invSumSquares(k)};
+    }
+
+    constexpr size_t lookupIndex(uint32_t format, uint32_t channelWidth)
+    {
+        return ((format & RATE_MCS_MOD_TYPE_MSK) >> RATE_MCS_MOD_TYPE_POS) * 8 + ((channelWidth & RATE_MCS_CHAN_WIDTH_MSK) >> RATE_MCS_CHAN_WIDTH_POS);
+    }
+
+    inline constexpr std::array<ToneRange, 2> NOHT_20_TONES = {{{-26, -1}, {1, 26}}};
+    inline constexpr std::array<ToneRange, 2> HT_VHT_20_TONES = {{{-28, -1}, {1, 28}}};
+    inline constexpr std::array<ToneRange, 2> HT_VHT_40_TONES = {{{-58, -2}, {2, 58}}};
+    inline constexpr std::array<ToneRange, 2> VHT_80_TONES = {{{-122, -2}, {2, 122}}};
+    inline constexpr std::array<ToneRange, 4> VHT_160_TONES = {{{-250, -130}, {-126, -6}, {6, 126}, {130, 250}}};
+    inline constexpr std::array<ToneRange, 2> HE_20_TONES = {{{-122, -2}, {2, 122}}};
+    inline constexpr std::array<ToneRange, 2> HE_40_TONES = {{{-244, -3}, {3, 244}}};
+    inline constexpr std::array<ToneRange, 2> HE_80_TONES = {{{-500, -3}, {3, 500}}};
+    inline constexpr std::array<ToneRange, 4> HE_160_TONES = {{{-1012, -515}, {-509, -12}, {12, 509}, {515, 1012}}};
+
+    inline constexpr auto NOHT_20_K = toneIndices<toneCount(NOHT_20_TONES)>(NOHT_20_TONES);
+    inline constexpr auto HT_VHT_20_K = toneIndices<toneCount(HT_VHT_20_TONES)>(HT_VHT_20_TONES);
+    inline constexpr auto HT_VHT_40_K = toneIndices<toneCount(HT_VHT_40_TONES)>(HT_VHT_40_TONES);
+    inline constexpr auto VHT_80_K = toneIndices<toneCount(VHT_80_TONES)>(VHT_80_TONES);
+    inline constexpr auto VHT_160_K = toneIndices<toneCount(VHT_160_TONES)>(VHT_160_TONES);
+    inline constexpr auto HE_20_K = toneIndices<toneCount(HE_20_TONES)>(HE_20_TONES);
+    inline constexpr auto HE_40_K = toneIndices<toneCount(HE_40_TONES)>(HE_40_TONES);
+    inline constexpr auto HE_80_K = toneIndices<toneCount(HE_80_TONES)>(HE_80_TONES);
+    inline constexpr auto HE_160_K = toneIndices<toneCount(HE_160_TONES)>(HE_160_TONES);
+
+    inline constexpr auto NOHT_20_NULLS = nullRanges(NOHT_20_TONES);
+    inline constexpr auto HT_VHT_20_NULLS = nullRanges(HT_VHT_20_TONES);
+    inline constexpr auto HT_VHT_40_NULLS = nullRanges(HT_VHT_40_TONES);
+    inline constexpr auto VHT_80_NULLS = nullRanges(VHT_80_TONES);
+    inline constexpr auto VHT_160_NULLS = nullRanges(VHT_160_TONES);
+    inline constexpr auto HE_20_NULLS = nullRanges(HE_20_TONES);
+    inline constexpr auto HE_40_NULLS = nullRanges(HE_40_TONES);
+    inline constexpr auto HE_80_NULLS = nullRanges(HE_80_TONES);
+    inline constexpr auto HE_160_NULLS = nullRanges(HE_160_TONES);
+
+    inline constexpr std::array<uint32_t, 4> NOHT_20_PILOTS = {5, 19, 32, 46};
+    inline constexpr std::array<uint32_t, 4> HT_VHT_20_PILOTS = {7, 21, 34, 48};
+    inline constexpr std::array<uint32_t, 6> HT_VHT_40_PILOTS = {5, 33, 47, 66, 80, 108};
+    inline constexpr std::array<uint32_t, 8> VHT_80_PILOTS = {19, 47, 83, 111, 130, 158, 194, 222};
+    inline constexpr std::array<uint32_t, 16> VHT_160_PILOTS = {19, 47, 83, 111, 130, 158, 194, 222, 261, 289, 325, 353, 372, 400, 436, 464};
+    inline constexpr std::array<uint32_t, 8> HE_20_PILOTS = {6, 32, 74, 100, 141, 167, 209, 235};
+    inline constexpr std::array<uint32_t, 16> HE_40_PILOTS = {6, 32, 74, 100, 140, 166, 208, 234, 249, 275, 317, 343, 383, 409, 451, 477};
+    inline constexpr std::array<uint32_t, 16> HE_80_PILOTS = {32, 100, 166, 234, 274, 342, 408, 476, 519, 587, 653, 721, 761, 829, 895, 963};
+    inline constexpr std::array<uint32_t, 32> HE_160_PILOTS = {32, 100, 166, 234, 274, 342, 408, 476, 519, 587, 653, 721, 761, 829, 895, 963, 1028, 1096, 1162, 1230, 1270, 1338, 1404, 1472, 1515, 1583, 1649, 1717, 1757, 1825, 1891, 1959};
+
+    inline constexpr std::array<SubcarrierLayout, 11> LAYOUTS = {{
+        make(RATE_MCS_LEGACY_OFDM_MSK, RATE_MCS_CHAN_WIDTH_20, 64, NOHT_20_K, NOHT_20_PILOTS, NOHT_20_NULLS),
+        make(RATE_MCS_HT_MSK, RATE_MCS_CHAN_WIDTH_20, 64, HT_VHT_20_K, HT_VHT_20_PILOTS, HT_VHT_20_NULLS),
+        make(RATE_MCS_HT_MSK, RATE_MCS_CHAN_WIDTH_40, 128, HT_VHT_40_K, HT_VHT_40_PILOTS, HT_VHT_40_NULLS),
+        make(RATE_MCS_VHT_MSK, RATE_MCS_CHAN_WIDTH_20, 64, HT_VHT_20_K, HT_VHT_20_PILOTS, HT_VHT_20_NULLS),
+        make(RATE_MCS_VHT_MSK, RATE_MCS_CHAN_WIDTH_40, 128, HT_VHT_40_K, HT_VHT_40_PILOTS, HT_VHT_40_NULLS),
+        make(RATE_MCS_VHT_MSK, RATE_MCS_CHAN_WIDTH_80, 256, VHT_80_K, VHT_80_PILOTS, VHT_80_NULLS),
+        make(RATE_MCS_VHT_MSK, RATE_MCS_CHAN_WIDTH_160, 512, VHT_160_K, VHT_160_PILOTS, VHT_160_NULLS, 242, 14),
+        make(RATE_MCS_HE_MSK, RATE_MCS_CHAN_WIDTH_20, 256, HE_20_K, HE_20_PILOTS, HE_20_NULLS),
+        make(RATE_MCS_HE_MSK, RATE_MCS_CHAN_WIDTH_40, 512, HE_40_K, HE_40_PILOTS, HE_40_NULLS),
+        make(RATE_MCS_HE_MSK, RATE_MCS_CHAN_WIDTH_80, 1024, HE_80_K, HE_80_PILOTS, HE_80_NULLS),
+        make(RATE_MCS_HE_MSK, RATE_MCS_CHAN_WIDTH_160, 2048, HE_160_K, HE_160_PILOTS, HE_160_NULLS, 996, 28),
+    }};
+
+    constexpr std::array<const SubcarrierLayout *, 64> buildLookup()
+    {
+        std::array<const SubcarrierLayout *, 64> lookup{};
+        for (const SubcarrierLayout &layout : LAYOUTS)
+        {
+            lookup[lookupIndex(layout.format, layout.channelWidth)] = &layout;
+        }
+        return lookup;
+    }
+
+    inline constexpr std::array<const SubcarrierLayout *, 64> LOOKUP = buildLookup();
+}
+
+// Layout for given format and channel width, nullptr when the combination is not known
+constexpr const SubcarrierLayout *getSubcarrierLayout(uint32_t format, uint32_t channelWidth)
+{
+    return subcarrierLayout::LOOKUP[subcarrierLayout::lookupIndex(format, channelWidth)];
+}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UDP_BATCH_SENDER_H
+#define UDP_BATCH_SENDER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <thread>
+#include <vector>
+#include "CsiChunk.h"
+#include "UdpSocket.h"
+
+#define UDP_BATCH_SIZE 32
+#define UDP_BATCH_LATENCY_US 2000
+// Chunk header, part of frame header and part of payload
+#define UDP_BATCH_IOVECS 3
+
+// Sends queued datagrams with one sendmmsg call. A datagram is gathered
+// from iovecs pointing at the caller's buffers, nothing is copied, so the
+// buffers have to stay valid until idle() reports the batch was sent. The
+// batch is flushed when it is full, on add() once the oldest datagram
+// waited longer than the latency budget, and otherwise by a timer thread
+// so the last frames before a pause are not held back. With mtu set, a
+// frame is cut into CsiChunkHeader chunks fitting the MTU, else it is sent
+// as one datagram.
+class UdpBatchSender
+{
+
+public:
+    UdpBatchSender(UdpSocket *udpSocket, uint32_t maxBatch = UDP_BATCH_SIZE, uint32_t maxLatencyUs = UDP_BATCH_LATENCY_US, uint32_t mtu = 0);
+    ~UdpBatchSender();
+    UdpBatchSender(const UdpBatchSender &) = delete;
+    UdpBatchSender &operator=(const UdpBatchSender &) = delete;
+
+    // Frame of header followed by payload, sent to recipients from UdpSocket::match()
+    void add(const void *header, size_t headerSize, const void *payload, size_t payloadSize, UdpRecipients recipients = {UDP_ALL_SUBSCRIBERS, UINT64_MAX});
+    void flush();
+    // Nothing queued, buffers of added datagrams can be reused
+    bool idle();
+
+    void printStatistics();
+
+private:
+    UdpSocket *udpSocket;
+    uint32_t maxBatch;
+    std::chrono::microseconds maxLatency;
+    uint32_t chunkPayload = 0; // 0 sends frames unchunked
+
+    std::vector<struct mmsghdr> messages;
+    std::vector<struct iovec> iovecs; // UDP_BATCH_IOVECS per message
+    std::vector<CsiChunkHeader> chunkHeaders;
+    std::vector<UdpRecipients> recipients; // of every queued message
+    uint32_t nextFrameId = 0;
+    uint32_t queued = 0;
+    std::chrono::steady_clock::time_point firstQueued;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    std::thread flusher;
+
+    uint64_t addedFrames = 0;
+    uint64_t sentDatagrams = 0; // before fan out to subscribers
+    uint64_t syscalls = 0;
+    uint64_t timerFlushes = 0;
+
+    void queue(const void *header, size_t headerSize, const void *payload, size_t payloadSize, uint32_t offset, uint32_t size, UdpRecipients recipients);
+    void flushLocked();
+    void flushLoop();
+};
+
+#endif
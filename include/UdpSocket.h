@@ -19,14 +19,76 @@
 #ifndef UDP_SOCKET_H
 #define UDP_SOCKET_H
 
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
 #include <sys/socket.h>
+#include <vector>
 
+#define UDP_MAX_SUBSCRIBERS 64
+#define UDP_SUBSCRIBER_LEASE_S 30
+#define UDP_ALL_SUBSCRIBERS UINT64_MAX
+
+// Client receiving the stream, see UdpSocket::subscribe()
+struct UdpSubscriber
+{
+    bool active = false;
+    struct sockaddr_storage addr;
+    socklen_t addrLen = 0;
+    std::chrono::steady_clock::time_point expires; // max() for clients which started measurement
+    uint32_t leaseS = UDP_SUBSCRIBER_LEASE_S;
+
+    // Filters, frames of other transmitters, formats or widths are skipped
+    bool anyMac = true;
+    uint8_t mac[6];
+    int64_t format = -1;       // RATE_MCS_*_MSK, -1 any
+    int64_t channelWidth = -1; // RATE_MCS_CHAN_WIDTH_*, -1 any
+    uint32_t every = 1;        // decimation, every Nth matching frame
+
+    uint64_t generation = 0; // UdpSocket generation when the slot was taken
+
+    uint64_t matchedFrames = 0;
+    uint64_t sentDatagrams = 0;
+    uint64_t droppedDatagrams = 0;
+};
+
+// Subscribers a datagram goes to, from UdpSocket::match()
+struct UdpRecipients
+{
+    uint64_t mask;       // bit per subscriber slot
+    uint64_t generation; // of UdpSocket at match(), slots taken later by new subscribers are skipped
+};
+
+// Control datagrams on PORT, from any client:
+//   "subscribe [mac=xx:xx:xx:xx:xx:xx] [format=NOHT|HT|VHT|HESU|EHT] [width=20|40|80|160] [every=N] [lease=S]"
+//     adds the sender as subscriber, or replaces its filters; it has to send again or
+//     "heartbeat" within lease seconds (default 30) or it is dropped
+//   "heartbeat" renews the lease, "unsubscribe" removes the sender
+//   "stop" stops measurement and removes the client which started it, anything else
+//     are program arguments starting it, the sender is subscribed without filters and
+//     lease in place of the client which started the previous measurement
+// Every datagram is built once and sent to all subscribers wanting it, sends
+// do not wait, a subscriber whose socket buffer is full loses datagrams
+// instead of stalling capture.
 class UdpSocket
 {
 
 public:
     void init();
+    // To all subscribers, e.g. motion events and FTM results
     void send(char *buf, int size);
+    // Each message goes to its recipients, returns number of sendmmsg calls
+    int send(struct mmsghdr *messages, const UdpRecipients *recipients, unsigned int count);
+    // Subscribers wanting the frame, advances their decimation
+    UdpRecipients match(const uint8_t *srcMac, uint32_t format, uint32_t channelWidth);
+
+    void subscribe(const struct sockaddr_storage &addr, socklen_t addrLen, const std::string &params, bool leased = true);
+    void unsubscribe(const struct sockaddr_storage &addr, socklen_t addrLen);
+    // Removes the client which started measurement
+    void unsubscribeController();
+    void heartbeat(const struct sockaddr_storage &addr, socklen_t addrLen);
+    void printStatistics();
 
 private:
 
@@ -34,6 +96,16 @@ private:
     bool running = false;
     struct sockaddr_storage peer_addr;
     socklen_t peer_addr_len;
+
+    std::mutex subscribersMutex;
+    UdpSubscriber subscribers[UDP_MAX_SUBSCRIBERS];
+    uint64_t generation = 0; // increments whenever a slot is taken
+    std::vector<struct mmsghdr> fanOut;
+    std::vector<uint8_t> fanOutSubscriber;
+
+    UdpSubscriber *findSubscriber(const struct sockaddr_storage &addr, socklen_t addrLen);
+    void expireSubscribers();
+    void removeController(const struct sockaddr_storage *keep, socklen_t keepLen);
 };
 
 #endif
\ No newline at end of file
@@ -21,6 +21,12 @@
 
 #include "Netlink.h"
 #include "Csi.h"
+#include "CsiArena.h"
+#include "FixedPointProcessor.h"
+#include "ProcessingPipeline.h"
+#include "StreamServer.h"
+#include "UdpBatchSender.h"
+#include <memory>
 #include <mutex>
 #include <queue>
 
@@ -42,6 +48,12 @@ public:
     ~WiFiCsiController();
 
 private:
+    ProcessingPipeline pipeline;
+    FixedPointProcessor fixedPoint;
+    CsiArena arena; // captured frames since udpSender was last idle, at most one UDP latency window
+    std::unique_ptr<UdpBatchSender> udpSender; // frames it still sends live in arena, so it goes first
+    std::unique_ptr<StreamServer> streamServer;
+
     static int listenToCsiHandler(nl80211_state *state, nl_msg *msg, void *arg);
     static int processListenToCsiHandler(nl_msg *msg, void *arg);
     static void printDetail(Csi *c);
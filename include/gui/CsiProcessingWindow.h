@@ -20,6 +20,8 @@
 #define CSI_PROCESSING_WINDOW_H
 
 #include <gtkmm.h>
+#include <memory>
+#include "CsiFrameStore.h"
 #include "CsiProcessor.h"
 
 class CsiProcessingWindow
@@ -30,6 +32,7 @@ public:
 private:
     Glib::RefPtr<Gtk::FileChooserButton> inputFile;
     Glib::RefPtr<Gtk::Label> currentDataCount;
+    Glib::RefPtr<Gtk::Label> memoryUsageLabel;
     Glib::RefPtr<Gtk::Button> previousCsiButton;
     Glib::RefPtr<Gtk::Button> nextCsiButton;
     Glib::RefPtr<Gtk::RadioButton> interpolationLinearRadioButton;
@@ -40,6 +43,8 @@ private:
 
     void inputFileChange();
     void refresh();
+    void updatePipeline();
+    void showFrame(uint32_t index);
     void previousCsiButtonClicked();
     void nextCsiButtonClicked();
 
@@ -54,6 +59,8 @@ private:
     void processingSaveGtkButtonClicked();
 
     CsiProcessor csiProcessor;
+    CsiFrameStore frameStore; // frames stay raw in the mapped file, only the browsed ones get decoded
+    std::shared_ptr<Csi> currentCsi;
 
     uint32_t currentIndex = 0;
 };
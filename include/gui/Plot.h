@@ -31,7 +31,7 @@ class Plot : public Gtk::DrawingArea
 public:
     void init();
     void init(Glib::RefPtr<Gtk::Box> box);
-    void updateData(Csi *csi, std::vector<double> *data);
+    void updateData(Csi *csi, std::pmr::vector<double> *data);
     double yTicksMax = 200;
     double yTicksMin = 0;
     std::string yLabel = "";
@@ -46,7 +46,7 @@ private:
         { 0.0, 1.0, 0.0 },
     };
     Csi *csi;
-    std::vector<double> *data;
+    std::pmr::vector<double> *data;
     std::mutex updateDataMutex;
     double yTicks;
     
@@ -17,7 +17,10 @@
  */
 
 #include "Arguments.h"
+#include "CsiChunk.h"
 #include "WiFIController.h"
+#include "FixedPointProcessor.h"
+#include "ProcessingPipeline.h"
 #include "rs.h"
 
 const std::string VERSION = (std::string("FeitCSI ") + FEITCSI_VERSION);
@@ -370,8 +373,145 @@ error_t Arguments::parse_opt(int key, char *arg, struct argp_state *state)
         }
         break;
     }
+    case OPTION_PIPELINE:
+    {
+        try
+        {
+            ProcessingPipeline pipeline(arg);
+        }
+        catch (const std::exception &e)
+        {
+            argp_failure(state, 1, 0, "%s", e.what());
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->pipeline = arg;
+        break;
+    }
+    case OPTION_THREADS:
+    {
+        int threads = std::atoi(arg);
+        if (threads < 0)
+        {
+            argp_failure(state, 1, 0, "Threads is not correct number");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->threads = (uint32_t)threads;
+        break;
+    }
+    case OPTION_FIXED_POINT:
+    {
+        try
+        {
+            FixedPointProcessor fixedPoint(arg);
+        }
+        catch (const std::exception &e)
+        {
+            argp_failure(state, 1, 0, "%s", e.what());
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->fixedPoint = arg;
+        break;
+    }
+    case OPTION_CACHE_DIR:
+        args->cacheDir = arg;
+        break;
+    case OPTION_CACHE_SIZE:
+    {
+        long long size = std::atoll(arg);
+        if (size < 0)
+        {
+            argp_failure(state, 1, 0, "Cache size is not correct number");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->cacheSize = (uint64_t)size;
+        break;
+    }
+    case OPTION_NO_CACHE:
+        args->noCache = true;
+        break;
+    case OPTION_EVENTS_ONLY:
+        args->eventsOnly = true;
+        break;
+    case OPTION_UDP_BATCH:
+    {
+        int batch = std::atoi(arg);
+        if (batch < 1 || batch > 1024)
+        {
+            argp_failure(state, 1, 0, "UDP batch is not correct number [1-1024]");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->udpBatch = (uint32_t)batch;
+        break;
+    }
+    case OPTION_UDP_LATENCY:
+    {
+        int latency = std::atoi(arg);
+        if (latency < 0)
+        {
+            argp_failure(state, 1, 0, "UDP latency is not correct number");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->udpLatency = (uint32_t)latency;
+        break;
+    }
+    case OPTION_UDP_MTU:
+    {
+        int mtu = std::atoi(arg);
+        if (mtu != 0 && (mtu < CSI_CHUNK_MIN_MTU || mtu > 65535))
+        {
+            argp_failure(state, 1, 0, "UDP MTU is not correct number, 0 or [%d-65535]", CSI_CHUNK_MIN_MTU);
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->udpMtu = (uint32_t)mtu;
+        break;
+    }
+    case OPTION_STREAM:
+        args->stream = arg;
+        break;
+    case OPTION_STREAM_QUEUE:
+    {
+        int queue = std::atoi(arg);
+        if (queue < 1)
+        {
+            argp_failure(state, 1, 0, "Stream queue is not correct number");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        args->streamQueue = (uint32_t)queue;
+        break;
+    }
+    case OPTION_STREAM_OVERFLOW:
+        try
+        {
+            args->streamOverflow = StreamServer::parseOverflow(arg);
+        }
+        catch (const std::invalid_argument &e)
+        {
+            argp_failure(state, 1, 0, "Stream overflow policy is not correct [drop-oldest|disconnect|block]");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        break;
+    case OPTION_PROCESS:
+        args->process = true;
+        break;
     case ARGP_KEY_ARG:
+        args->inputFiles.push_back(arg);
+        break;
     case ARGP_KEY_END:
+        if (args->process && args->inputFiles.empty())
+        {
+            argp_failure(state, 1, 0, "Processing needs INPUT files. See --help for more information");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        if (args->plot && args->udpMtu)
+        {
+            argp_failure(state, 1, 0, "UDP MTU is not supported with --plot, plotted frames are sent whole");
+            exit(ARGP_ERR_UNKNOWN);
+        }
+        if (args->process && !args->fixedPoint.empty())
+        {
+            argp_failure(state, 1, 0, "Fixed point stages run on captured CSI only, use --pipeline with --process");
+            exit(ARGP_ERR_UNKNOWN);
+        }
         if (args->frequency == 0 ||
             args->bandwidth.empty())
         {
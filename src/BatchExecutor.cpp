@@ -0,0 +1,239 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BatchExecutor.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+BatchExecutor::BatchExecutor(const std::string &pipelineSpec, uint32_t threadCount, uint32_t chunkSize) : pipelineSpec(pipelineSpec), threadCount(threadCount), chunkSize(chunkSize)
+{
+    if (this->threadCount == 0)
+    {
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (this->chunkSize == 0)
+    {
+        this->chunkSize = BATCH_EXECUTOR_CHUNK_SIZE;
+    }
+    // Enough chunks to keep every worker busy while the writer catches up
+    this->maxChunksInFlight = this->threadCount * 4;
+
+    for (uint32_t i = 0; i < this->threadCount; i++)
+    {
+        this->pipelines.push_back(std::make_unique<ProcessingPipeline>(pipelineSpec));
+    }
+
+    // Stages from the first sequential one on run on the writer thread, in capture order
+    this->orderedPipeline = std::make_unique<ProcessingPipeline>(pipelineSpec);
+    this->sequentialStart = this->orderedPipeline->getSequentialStart();
+}
+
+uint32_t BatchExecutor::getThreadCount() const
+{
+    return this->threadCount;
+}
+
+void BatchExecutor::run(const ChunkReader &reader, const ChunkWriter &writer)
+{
+    this->reorderBuffer.clear();
+    this->nextReadSequence = 0;
+    this->nextWriteSequence = 0;
+    this->inputExhausted = false;
+    this->aborted = false;
+    this->failure = nullptr;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread writerThread(&BatchExecutor::writer, this, std::cref(writer));
+    std::vector<std::thread> workers;
+    for (std::unique_ptr<ProcessingPipeline> &pipeline : this->pipelines)
+    {
+        workers.emplace_back(&BatchExecutor::worker, this, std::ref(*pipeline), std::cref(reader));
+    }
+
+    for (std::thread &t : workers)
+    {
+        t.join();
+    }
+    writerThread.join();
+
+    auto end = std::chrono::steady_clock::now();
+    this->elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    if (this->failure)
+    {
+        std::rethrow_exception(this->failure);
+    }
+}
+
+void BatchExecutor::worker(ProcessingPipeline &pipeline, const ChunkReader &reader)
+{
+    while (true)
+    {
+        std::vector<Csi *> chunk;
+        uint64_t sequence;
+        {
+            std::lock_guard<std::mutex> readLock(this->readMutex);
+            {
+                std::unique_lock<std::mutex> lock(this->reorderMutex);
+                this->chunkWritten.wait(lock, [this]
+                                        { return this->aborted || this->inputExhausted || this->nextReadSequence - this->nextWriteSequence < this->maxChunksInFlight; });
+                if (this->aborted || this->inputExhausted)
+                {
+                    return;
+                }
+            }
+
+            bool hasChunk;
+            try
+            {
+                hasChunk = reader(chunk, this->chunkSize);
+            }
+            catch (...)
+            {
+                this->abort(std::current_exception());
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(this->reorderMutex);
+            if (!hasChunk)
+            {
+                this->inputExhausted = true;
+                this->chunkProcessed.notify_all();
+                this->chunkWritten.notify_all();
+                return;
+            }
+            sequence = this->nextReadSequence++;
+        }
+
+        try
+        {
+            pipeline.process(chunk, 0, this->sequentialStart);
+        }
+        catch (...)
+        {
+            this->abort(std::current_exception());
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->reorderMutex);
+            this->reorderBuffer[sequence] = std::move(chunk);
+        }
+        this->chunkProcessed.notify_all();
+    }
+}
+
+void BatchExecutor::writer(const ChunkWriter &writer)
+{
+    while (true)
+    {
+        std::vector<Csi *> chunk;
+        {
+            std::unique_lock<std::mutex> lock(this->reorderMutex);
+            this->chunkProcessed.wait(lock, [this]
+                                      { return this->aborted ||
+                                               this->reorderBuffer.count(this->nextWriteSequence) ||
+                                               (this->inputExhausted && this->nextWriteSequence == this->nextReadSequence); });
+            if (this->aborted)
+            {
+                return;
+            }
+
+            auto it = this->reorderBuffer.find(this->nextWriteSequence);
+            if (it == this->reorderBuffer.end())
+            {
+                return;
+            }
+            chunk = std::move(it->second);
+            this->reorderBuffer.erase(it);
+        }
+
+        try
+        {
+            if (this->sequentialStart < this->orderedPipeline->getStages().size())
+            {
+                this->orderedPipeline->process(chunk, this->sequentialStart, this->orderedPipeline->getStages().size());
+            }
+            writer(chunk);
+        }
+        catch (...)
+        {
+            this->abort(std::current_exception());
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->reorderMutex);
+            this->nextWriteSequence++;
+            this->processedFrames += chunk.size();
+        }
+        this->chunkWritten.notify_all();
+    }
+}
+
+void BatchExecutor::abort(std::exception_ptr e)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->reorderMutex);
+        if (!this->failure)
+        {
+            this->failure = e;
+        }
+        this->aborted = true;
+    }
+    this->chunkProcessed.notify_all();
+    this->chunkWritten.notify_all();
+}
+
+void BatchExecutor::printStatistics(uint64_t bytes)
+{
+    if (!this->pipelines.empty())
+    {
+        const std::vector<std::unique_ptr<ProcessingStage>> &stages = this->pipelines[0]->getStages();
+        for (uint32_t s = 0; s < stages.size(); s++)
+        {
+            uint64_t frames = 0;
+            uint64_t timeNs = 0;
+            for (std::unique_ptr<ProcessingPipeline> &pipeline : this->pipelines)
+            {
+                frames += pipeline->getStages()[s]->processedFrames;
+                timeNs += pipeline->getStages()[s]->processingTimeNs;
+            }
+            frames += this->orderedPipeline->getStages()[s]->processedFrames;
+            timeNs += this->orderedPipeline->getStages()[s]->processingTimeNs;
+            double fps = timeNs ? frames * 1e9 / timeNs : 0;
+            Logger::log(info) << "Stage " << stages[s]->name() << ": " << frames << " frames, " << timeNs / 1e6 << " ms CPU, " << fps << " frames/s per thread\n";
+        }
+    }
+
+    double seconds = this->elapsedNs / 1e9;
+    Logger::log(info) << "Processed " << this->processedFrames << " frames on " << this->threadCount << " threads in " << seconds << " s";
+    if (seconds > 0)
+    {
+        Logger::log(info, true) << ", " << this->processedFrames / seconds << " frames/s";
+        if (bytes)
+        {
+            Logger::log(info, true) << ", " << bytes / seconds / 1e6 << " MB/s";
+        }
+    }
+    Logger::log(info, true) << "\n";
+}
@@ -0,0 +1,297 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BatchProcessor.h"
+#include "CsiFrameStore.h"
+#include "CsiProcessor.h"
+#include "Logger.h"
+#include "Arguments.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <glob.h>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+BatchProcessor::BatchProcessor(const std::string &pipelineSpec, uint32_t threadCount, uint32_t chunkSize) : pipelineSpec(pipelineSpec), threadCount(threadCount), chunkSize(chunkSize)
+{
+    if (this->threadCount == 0)
+    {
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (this->chunkSize == 0)
+    {
+        this->chunkSize = BATCH_EXECUTOR_CHUNK_SIZE;
+    }
+
+    // Fails early on a bad spec, workers build their own pipelines
+    ProcessingPipeline pipeline(pipelineSpec);
+    if (pipeline.hasOutput())
+    {
+        // Every input runs its own pipeline concurrently, their records would interleave in one file
+        throw std::invalid_argument("Stage output= and shm= are not supported with --process, outputs of all inputs would mix");
+    }
+}
+
+std::vector<std::string> BatchProcessor::expandInputs(const std::vector<std::string> &patterns)
+{
+    std::vector<std::string> files;
+    std::set<std::string> seen;
+    for (const std::string &pattern : patterns)
+    {
+        glob_t matches;
+        int result = glob(pattern.c_str(), GLOB_TILDE | GLOB_BRACE, nullptr, &matches);
+        if (result != 0)
+        {
+            globfree(&matches);
+            throw std::invalid_argument("No input file matches: " + pattern);
+        }
+        for (size_t i = 0; i < matches.gl_pathc; i++)
+        {
+            // Outputs of an earlier run next to the inputs, a worker would truncate a file another one has mapped
+            const std::string name = std::filesystem::path(matches.gl_pathv[i]).filename().string();
+            const size_t extensionLength = strlen(BATCH_PROCESSOR_OUTPUT_EXTENSION);
+            if (name.size() > extensionLength && name.compare(name.size() - extensionLength, extensionLength, BATCH_PROCESSOR_OUTPUT_EXTENSION) == 0)
+            {
+                continue;
+            }
+            // Processing the same file twice would write the same output concurrently
+            std::string file = std::filesystem::weakly_canonical(matches.gl_pathv[i]).string();
+            if (seen.insert(file).second)
+            {
+                files.push_back(matches.gl_pathv[i]);
+            }
+        }
+        globfree(&matches);
+    }
+    if (files.empty())
+    {
+        throw std::invalid_argument("No input file left, " BATCH_PROCESSOR_OUTPUT_EXTENSION " files are outputs");
+    }
+    return files;
+}
+
+uint32_t BatchProcessor::run(const std::vector<std::string> &inputFiles, const std::string &outputDirectory, ProcessedCache *cache)
+{
+    this->inputs = inputFiles;
+    this->outputs.clear();
+    this->cache = cache;
+    this->failedFiles = 0;
+
+    if (!outputDirectory.empty())
+    {
+        std::filesystem::create_directories(outputDirectory);
+    }
+    // Every output is written by one worker only and none of them may be an input another worker has mapped
+    std::map<std::string, size_t> written;
+    std::set<std::string> read;
+    for (const std::string &input : this->inputs)
+    {
+        read.insert(std::filesystem::weakly_canonical(input).string());
+    }
+    std::vector<std::pair<uint64_t, size_t>> bySize;
+    for (size_t i = 0; i < this->inputs.size(); i++)
+    {
+        std::filesystem::path output = outputDirectory.empty() ? std::filesystem::path(this->inputs[i]) : std::filesystem::path(outputDirectory) / std::filesystem::path(this->inputs[i]).filename();
+        output.replace_extension(BATCH_PROCESSOR_OUTPUT_EXTENSION);
+        this->outputs.push_back(output.string());
+
+        const std::string canonical = std::filesystem::weakly_canonical(output).string();
+        auto [previous, inserted] = written.emplace(canonical, i);
+        if (!inserted)
+        {
+            throw std::invalid_argument("Inputs " + this->inputs[previous->second] + " and " + this->inputs[i] + " would both write " + this->outputs[i]);
+        }
+        if (read.count(canonical))
+        {
+            throw std::invalid_argument("Output " + this->outputs[i] + " of " + this->inputs[i] + " is an input");
+        }
+
+        std::error_code error;
+        const uint64_t size = std::filesystem::file_size(this->inputs[i], error);
+        bySize.emplace_back(error ? 0 : size, i);
+    }
+
+    // Largest first, dealt round robin, a worker left with small files steals the rest at the end
+    std::sort(bySize.begin(), bySize.end(), std::greater<>());
+    this->queues.clear();
+    for (uint32_t i = 0; i < this->threadCount; i++)
+    {
+        this->queues.push_back(std::make_unique<FileQueue>());
+    }
+    for (size_t i = 0; i < bySize.size(); i++)
+    {
+        this->queues[i % this->threadCount]->files.push_back(bySize[i].second);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < this->threadCount; i++)
+    {
+        workers.emplace_back(&BatchProcessor::worker, this, i);
+    }
+    for (std::thread &t : workers)
+    {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    this->elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    return this->failedFiles;
+}
+
+bool BatchProcessor::nextFile(uint32_t worker, size_t &file)
+{
+    {
+        FileQueue &own = *this->queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.files.empty())
+        {
+            file = own.files.front();
+            own.files.pop_front();
+            return true;
+        }
+    }
+
+    // Steal the smallest remaining file of another worker, its large ones stay with it
+    for (uint32_t i = 1; i < this->threadCount; i++)
+    {
+        FileQueue &victim = *this->queues[(worker + i) % this->threadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.files.empty())
+        {
+            file = victim.files.back();
+            victim.files.pop_back();
+            this->stolenFiles++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void BatchProcessor::worker(uint32_t id)
+{
+    CsiArena arena;
+    size_t file;
+    while (this->nextFile(id, file))
+    {
+        try
+        {
+            this->processFile(arena, file);
+        }
+        catch (const std::exception &e)
+        {
+            this->failedFiles++;
+            std::lock_guard<std::mutex> lock(this->logMutex);
+            Logger::log(error) << this->inputs[file] << ": " << e.what() << '\n';
+        }
+        arena.release();
+    }
+}
+
+void BatchProcessor::processFile(CsiArena &arena, size_t file)
+{
+    const std::string &input = this->inputs[file];
+    const std::string &output = this->outputs[file];
+
+    CsiFrameStore store(1, 0);
+    store.open(input);
+
+    std::ofstream outfile(output, std::ios::binary | std::ios::trunc);
+    if (outfile.fail())
+    {
+        throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
+    }
+
+    std::string key;
+    std::unique_ptr<ProcessedCache::Writer> cacheWriter;
+    // Specs with stage outputs are rejected by the constructor, a hit skips nothing but frames
+    if (this->cache)
+    {
+        key = ProcessedCache::makeKey(input, store, this->pipelineSpec);
+        uint64_t bytes = 0;
+        if (this->cache->serve(key, outfile, bytes))
+        {
+            this->cachedFiles++;
+            this->bytesRead += store.getMappedSize();
+            this->bytesWritten += bytes;
+            this->processedFrames += store.size();
+            return;
+        }
+        cacheWriter = std::make_unique<ProcessedCache::Writer>(*this->cache, key);
+    }
+
+    // Fresh pipeline per file, stages keeping state across frames must not mix captures
+    ProcessingPipeline pipeline(this->pipelineSpec);
+    std::vector<Csi *> chunk;
+    chunk.reserve(this->chunkSize);
+    uint64_t written = 0;
+    for (size_t next = 0; next < store.size();)
+    {
+        chunk.clear();
+        while (next < store.size() && chunk.size() < this->chunkSize)
+        {
+            Csi *csi = arena.createCsi();
+            csi->loadFromMemory(const_cast<uint8_t *>(store.getRawFrame(next++)));
+            chunk.push_back(csi);
+        }
+        pipeline.process(chunk);
+        for (Csi *csi : chunk)
+        {
+            written += CsiProcessor::writeProcessed(outfile, *csi, cacheWriter.get());
+        }
+        arena.release();
+    }
+
+    outfile.close();
+    if (outfile.fail())
+    {
+        throw std::ios_base::failure("Write file failed: " + output);
+    }
+    if (cacheWriter)
+    {
+        cacheWriter->commit();
+    }
+
+    this->processedFiles++;
+    this->processedFrames += store.size();
+    this->bytesRead += store.getMappedSize();
+    this->bytesWritten += written;
+    if (Arguments::arguments.verbose)
+    {
+        std::lock_guard<std::mutex> lock(this->logMutex);
+        Logger::log(info) << input << " -> " << output << ", " << store.size() << " frames\n";
+    }
+}
+
+void BatchProcessor::printStatistics()
+{
+    double seconds = this->elapsedNs / 1e9;
+    Logger::log(info) << "Processed " << this->processedFiles + this->cachedFiles << " files (" << this->cachedFiles << " from cache, " << this->failedFiles << " failed, " << this->stolenFiles << " stolen), "
+                      << this->processedFrames << " frames on " << this->threadCount << " threads in " << seconds << " s";
+    if (seconds > 0)
+    {
+        Logger::log(info, true) << ", " << this->processedFrames / seconds << " frames/s, " << this->bytesRead / seconds / 1e6 << " MB/s read, " << this->bytesWritten / seconds / 1e6 << " MB/s written";
+    }
+    Logger::log(info, true) << "\n";
+}
@@ -0,0 +1,143 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CirStage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+CirStage::CirStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            if (value == "rectangular")
+            {
+                this->windowType = window::rectangular;
+            }
+            else if (value == "hann")
+            {
+                this->windowType = window::hann;
+            }
+            else if (value == "hamming")
+            {
+                this->windowType = window::hamming;
+            }
+            else if (value == "blackman")
+            {
+                this->windowType = window::blackman;
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown window: " + value);
+            }
+        }
+        else if (key == "size")
+        {
+            this->minSize = std::stoul(value);
+            // Validates the size and builds the FFT plan up front
+            Fft::get(this->minSize);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of cir: " + key);
+        }
+    }
+}
+
+const char *CirStage::name() const
+{
+    return "cir";
+}
+
+void CirStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->transform(*csi);
+    }
+}
+
+void CirStage::transform(Csi &csi)
+{
+    if (!csi.layout)
+    {
+        csi.cir.clear();
+        return;
+    }
+
+    const Plan &plan = this->getPlan(*csi.layout);
+    const uint32_t size = plan.fft->getSize();
+    const uint32_t chains = csi.numRx * csi.numTx;
+    csi.cir.assign(chains * size, 0);
+
+    for (uint32_t c = 0; c < chains; c++)
+    {
+        const std::complex<double> *in = csi.csi.data() + c * csi.numSubCarriers;
+        std::complex<double> *out = csi.cir.data() + c * size;
+        for (uint32_t i = 0; i < csi.numSubCarriers; i++)
+        {
+            out[plan.bins[i]] = in[i] * plan.weights[i];
+        }
+        plan.fft->inverse(out);
+    }
+}
+
+const CirStage::Plan &CirStage::getPlan(const SubcarrierLayout &layout)
+{
+    auto it = this->plans.find(&layout);
+    if (it != this->plans.end())
+    {
+        return it->second;
+    }
+
+    Plan &plan = this->plans[&layout];
+    plan.fft = &Fft::get(std::max(this->minSize, layout.fftSize));
+
+    const int32_t size = plan.fft->getSize();
+    const double first = layout.k[0];
+    const double span = layout.k[layout.numSubCarriers - 1] - first;
+    plan.bins.resize(layout.numSubCarriers);
+    plan.weights.resize(layout.numSubCarriers);
+    for (uint32_t i = 0; i < layout.numSubCarriers; i++)
+    {
+        // Negative frequencies wrap to the upper half of the IFFT input
+        plan.bins[i] = (layout.k[i] + size) % size;
+
+        // Window over the whole occupied band, including nulls
+        const double x = span > 0 ? (layout.k[i] - first) / span : 0.5;
+        switch (this->windowType)
+        {
+        case window::rectangular:
+            plan.weights[i] = 1;
+            break;
+        case window::hann:
+            plan.weights[i] = 0.5 - 0.5 * std::cos(2 * M_PI * x);
+            break;
+        case window::hamming:
+            plan.weights[i] = 0.54 - 0.46 * std::cos(2 * M_PI * x);
+            break;
+        case window::blackman:
+            plan.weights[i] = 0.42 - 0.5 * std::cos(2 * M_PI * x) + 0.08 * std::cos(4 * M_PI * x);
+            break;
+        }
+    }
+    return plan;
+}
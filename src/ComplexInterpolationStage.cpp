@@ -0,0 +1,304 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ComplexInterpolationStage.h"
+#include "ShapeKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+// Spline weights decay exponentially with distance, smaller ones are dropped from the stencil
+#define SPLINE_WEIGHT_THRESHOLD 1e-6
+
+ComplexInterpolationStage::ComplexInterpolationStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "method")
+        {
+            if (value == "linear")
+            {
+                this->interpolationMethod = method::linear;
+            }
+            else if (value == "hermite")
+            {
+                this->interpolationMethod = method::hermite;
+            }
+            else if (value == "spline")
+            {
+                this->interpolationMethod = method::spline;
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown interpolation method: " + value);
+            }
+        }
+        else if (key == "mask")
+        {
+            if (value != "pilots" && value != "none")
+            {
+                throw std::invalid_argument("Unknown interpolation mask: " + value);
+            }
+            this->maskPilots = value == "pilots";
+        }
+        else if (key == "bins")
+        {
+            std::istringstream binStream(value);
+            std::string bin;
+            while (std::getline(binStream, bin, '+'))
+            {
+                this->bins.push_back(std::stoul(bin));
+            }
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of interpolateComplex: " + key);
+        }
+    }
+}
+
+const char *ComplexInterpolationStage::name() const
+{
+    return "interpolateComplex";
+}
+
+void ComplexInterpolationStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->interpolate(*csi);
+    }
+}
+
+void ComplexInterpolationStage::interpolate(Csi &csi)
+{
+    if (!csi.layout)
+    {
+        return;
+    }
+
+    const Stencil &stencil = this->getStencil(*csi.layout);
+    if (stencil.targets.empty())
+    {
+        return;
+    }
+
+    shapeKernels::dispatch(csi.numRx * csi.numTx, csi.numSubCarriers, [&](auto shape)
+                           { shapeKernels::applyStencil(shape, csi.csi.data(), stencil.targets.data(), stencil.targets.size(),
+                                                        stencil.offsets.data(), stencil.sources.data(), stencil.weights.data()); });
+
+    // Only the replaced subcarriers need new magnitude and phase
+    for (uint32_t c = 0; c < csi.numRx * csi.numTx; c++)
+    {
+        for (uint32_t target : stencil.targets)
+        {
+            const uint32_t i = c * csi.numSubCarriers + target;
+            csi.magnitude[i] = std::abs(csi.csi[i]);
+            csi.phase[i] = std::arg(csi.csi[i]);
+        }
+    }
+}
+
+const ComplexInterpolationStage::Stencil &ComplexInterpolationStage::getStencil(const SubcarrierLayout &layout)
+{
+    auto it = this->stencils.find(&layout);
+    if (it != this->stencils.end())
+    {
+        return it->second;
+    }
+
+    std::vector<bool> masked(layout.numSubCarriers, false);
+    if (this->maskPilots)
+    {
+        for (uint32_t i = 0; i < layout.numPilots; i++)
+        {
+            masked[layout.pilots[i]] = true;
+        }
+    }
+    for (uint32_t bin : this->bins)
+    {
+        if (bin < layout.numSubCarriers)
+        {
+            masked[bin] = true;
+        }
+    }
+
+    std::vector<uint32_t> known;
+    std::vector<double> x;
+    for (uint32_t i = 0; i < layout.numSubCarriers; i++)
+    {
+        if (!masked[i])
+        {
+            known.push_back(i);
+            x.push_back(layout.k[i]);
+        }
+    }
+
+    Stencil &stencil = this->stencils[&layout];
+    stencil.offsets.push_back(0);
+    if (known.empty())
+    {
+        return stencil;
+    }
+
+    std::map<uint32_t, double> weights;
+    for (uint32_t i = 0; i < layout.numSubCarriers; i++)
+    {
+        if (!masked[i])
+        {
+            continue;
+        }
+
+        weights.clear();
+        this->buildWeights(x, layout.k[i], weights);
+
+        stencil.targets.push_back(i);
+        for (const auto &[j, w] : weights)
+        {
+            stencil.sources.push_back(known[j]);
+            stencil.weights.push_back(w);
+        }
+        stencil.offsets.push_back(stencil.sources.size());
+    }
+    return stencil;
+}
+
+// Weights of known points x (sorted) giving the interpolated value at target
+void ComplexInterpolationStage::buildWeights(const std::vector<double> &x, double target, std::map<uint32_t, double> &weights) const
+{
+    const uint32_t n = x.size();
+
+    // Nearest value outside of the known range
+    if (n == 1 || target <= x.front())
+    {
+        weights[0] = 1;
+        return;
+    }
+    if (target >= x.back())
+    {
+        weights[n - 1] = 1;
+        return;
+    }
+
+    // Interval [x[l], x[l + 1]] containing target
+    const uint32_t l = std::upper_bound(x.begin(), x.end(), target) - x.begin() - 1;
+    const uint32_t r = l + 1;
+    const double h = x[r] - x[l];
+    const double s = (target - x[l]) / h;
+
+    if (this->interpolationMethod == method::linear || n == 2)
+    {
+        weights[l] = 1 - s;
+        weights[r] = s;
+        return;
+    }
+
+    if (this->interpolationMethod == method::hermite)
+    {
+        const double h00 = 2 * s * s * s - 3 * s * s + 1;
+        const double h10 = s * s * s - 2 * s * s + s;
+        const double h01 = -2 * s * s * s + 3 * s * s;
+        const double h11 = s * s * s - s * s;
+        weights[l] += h00;
+        weights[r] += h01;
+
+        // Finite difference tangents, one sided at the edges of known points
+        if (l > 0)
+        {
+            const double t = h10 * h / (x[r] - x[l - 1]);
+            weights[r] += t;
+            weights[l - 1] -= t;
+        }
+        else
+        {
+            weights[r] += h10;
+            weights[l] -= h10;
+        }
+        if (r + 1 < n)
+        {
+            const double t = h11 * h / (x[r + 1] - x[l]);
+            weights[r + 1] += t;
+            weights[l] -= t;
+        }
+        else
+        {
+            weights[r] += h11;
+            weights[l] -= h11;
+        }
+        return;
+    }
+
+    // Natural cubic spline, value = a y[l] + b y[r] + ca M[l] + cb M[r] where second
+    // derivatives M = A^-1 D y, A is tridiagonal over interior points and D maps y
+    // to second differences. Weights of y are then a, b plus D^T A^-1 (ca, cb).
+    const double a = 1 - s;
+    const double b = s;
+    weights[l] += a;
+    weights[r] += b;
+
+    const uint32_t m = n - 2;
+    std::vector<double> rhs(m, 0);
+    if (l >= 1 && l <= m)
+    {
+        rhs[l - 1] = (a * a * a - a) * h * h / 6;
+    }
+    if (r >= 1 && r <= m)
+    {
+        rhs[r - 1] = (b * b * b - b) * h * h / 6;
+    }
+
+    // Thomas algorithm on the symmetric tridiagonal A
+    std::vector<double> diagonal(m);
+    std::vector<double> z(m);
+    for (uint32_t i = 0; i < m; i++)
+    {
+        const double hPrev = x[i + 1] - x[i];
+        const double hNext = x[i + 2] - x[i + 1];
+        diagonal[i] = 2 * (hPrev + hNext);
+        z[i] = rhs[i];
+        if (i > 0)
+        {
+            const double factor = hPrev / diagonal[i - 1];
+            diagonal[i] -= factor * hPrev;
+            z[i] -= factor * z[i - 1];
+        }
+    }
+    for (uint32_t i = m; i-- > 0;)
+    {
+        if (i + 1 < m)
+        {
+            z[i] -= (x[i + 2] - x[i + 1]) * z[i + 1];
+        }
+        z[i] /= diagonal[i];
+    }
+
+    for (uint32_t i = 0; i < m; i++)
+    {
+        if (std::abs(z[i]) < SPLINE_WEIGHT_THRESHOLD)
+        {
+            continue;
+        }
+        const double hPrev = x[i + 1] - x[i];
+        const double hNext = x[i + 2] - x[i + 1];
+        weights[i] += 6 / hPrev * z[i];
+        weights[i + 1] -= (6 / hPrev + 6 / hNext) * z[i];
+        weights[i + 2] += 6 / hNext * z[i];
+    }
+}
@@ -24,11 +24,16 @@
 #include <vector>
 #include <iostream>
 #include <filesystem>
+#include <algorithm>
+#include <cmath>
 #include "rs.h"
 #include "Logger.h"
 #include "Arguments.h"
+#include "ShapeKernels.h"
+#include <sys/uio.h>
 
-Csi::Csi()
+Csi::Csi(std::pmr::memory_resource *resource)
+    : csi(resource), magnitude(resource), phase(resource), cir(resource), paths(resource), resource(resource)
 {
 }
 
@@ -36,15 +41,44 @@ Csi::~Csi()
 {
     if (this->rawCsiData)
     {
-        delete rawCsiData;
+        this->resource->deallocate(this->rawCsiData, this->rawCsiCapacity);
     }
+    if (this->processedCsiData)
+    {
+        this->resource->deallocate(this->processedCsiData, this->processedCsiCapacity);
+    }
+}
+
+// Previous content is not kept, capacity only grows so reloading a frame reuses it
+void Csi::allocateRawCsiData(uint32_t size)
+{
+    if (size <= this->rawCsiCapacity)
+    {
+        return;
+    }
+    if (this->rawCsiData)
+    {
+        this->resource->deallocate(this->rawCsiData, this->rawCsiCapacity);
+    }
+    this->rawCsiData = static_cast<uint8_t *>(this->resource->allocate(size));
+    this->rawCsiCapacity = size;
+}
+
+RawHeaderData *Csi::outputHeader()
+{
+    return this->processed ? &this->processedHeaderData : &this->rawHeaderData;
+}
+
+uint8_t *Csi::outputCsiData()
+{
+    return this->processed ? this->processedCsiData : this->rawCsiData;
 }
 
 void Csi::loadFromFile(std::string fileName)
 {
     std::ifstream ifs(fileName, std::ios::binary);
     ifs.read((char *)&this->rawHeaderData, CSI_HEADER_LENGTH);
-    this->rawCsiData = new uint8_t[this->rawHeaderData.csiDataSize];
+    this->allocateRawCsiData(this->rawHeaderData.csiDataSize);
 
     // uint8_t rawCsiData[this->rawHeaderData.csiDataSize];
 
@@ -53,20 +87,20 @@ void Csi::loadFromFile(std::string fileName)
     this->processRawCsi();
 }
 
-void Csi::loadFromMemory(uint8_t *pHeader, uint8_t *pRawCsiData)
+void Csi::loadFromMemory(uint8_t *pHeader, uint8_t *pRawCsiData, bool decode)
 {
     memcpy(&this->rawHeaderData, pHeader, CSI_HEADER_LENGTH);
-    this->rawCsiData = new uint8_t[this->rawHeaderData.csiDataSize];
+    this->allocateRawCsiData(this->rawHeaderData.csiDataSize);
     memcpy(this->rawCsiData, pRawCsiData, this->rawHeaderData.csiDataSize);
     //this->rawHeaderData.timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-    this->processRawCsi();
+    this->processRawCsi(decode);
 }
 
 void Csi::loadFromMemory(uint8_t *rawData)
 {
     memcpy(&this->rawHeaderData, rawData, CSI_HEADER_LENGTH);
-    this->rawCsiData = new uint8_t[this->rawHeaderData.csiDataSize];
+    this->allocateRawCsiData(this->rawHeaderData.csiDataSize);
     memcpy(this->rawCsiData, &rawData[CSI_HEADER_LENGTH], this->rawHeaderData.csiDataSize);
     this->processRawCsi();
 }
@@ -79,63 +113,51 @@ void Csi::save()
     {
         throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
     }
-    outfile.write(reinterpret_cast<char *>(&this->rawHeaderData), sizeof(RawHeaderData));
-    outfile.write(reinterpret_cast<char *>(this->rawCsiData), this->rawHeaderData.csiDataSize);
+    RawHeaderData *header = this->outputHeader();
+    outfile.write(reinterpret_cast<char *>(header), sizeof(RawHeaderData));
+    outfile.write(reinterpret_cast<char *>(this->outputCsiData()), header->csiDataSize);
     outfile.close();
     std::filesystem::permissions(Arguments::arguments.outputFile, std::filesystem::perms::all & ~(std::filesystem::perms::owner_exec | std::filesystem::perms::group_exec | std::filesystem::perms::others_exec), std::filesystem::perm_options::add);
 }
 
 void Csi::sendUDP(UdpSocket *udpSocket)
 {
-    int size = CSI_HEADER_LENGTH + this->rawHeaderData.csiDataSize;
-    char data[size]; 
-    memcpy(data, &this->rawHeaderData, CSI_HEADER_LENGTH);
-    memcpy(&data[CSI_HEADER_LENGTH], this->rawCsiData, this->rawHeaderData.csiDataSize);
-    udpSocket->send(data, size);
-}
-
-void Csi::fixCsiBug()
-{
-    if (this->channelWidth != RATE_MCS_CHAN_WIDTH_160)
+    // Header and data are gathered by the kernel, no copy into a datagram buffer
+    RawHeaderData *header = this->outputHeader();
+    struct iovec iov[2] = {{header, CSI_HEADER_LENGTH}, {this->outputCsiData(), header->csiDataSize}};
+    struct mmsghdr message = {};
+    message.msg_hdr.msg_iov = iov;
+    message.msg_hdr.msg_iovlen = 2;
+    const UdpRecipients recipients = udpSocket->match(this->rawHeaderData.srcMac, this->format, this->channelWidth);
+    if (recipients.mask)
     {
-        return;
+        udpSocket->send(&message, &recipients, 1);
     }
+}
 
-    if (this->format != RATE_MCS_VHT_MSK && this->format != RATE_MCS_HE_MSK)
-    {
-        return;
-    }
+void Csi::sendUDP(UdpBatchSender *udpSender, UdpSocket *udpSocket)
+{
+    RawHeaderData *header = this->outputHeader();
+    udpSender->add(header, CSI_HEADER_LENGTH, this->outputCsiData(), header->csiDataSize, udpSocket->match(this->rawHeaderData.srcMac, this->format, this->channelWidth));
+}
 
-    uint16_t newSubcarrierSize = 0;
-    if (this->format == RATE_MCS_VHT_MSK && this->rawHeaderData.numSubCarriers == 484)
-    {
-        return;
-    }
-    else if (this->format == RATE_MCS_VHT_MSK)
-    {
-        newSubcarrierSize = 484;
-    }
+void Csi::sendStream(StreamServer *streamServer)
+{
+    RawHeaderData *header = this->outputHeader();
+    streamServer->send(header, CSI_HEADER_LENGTH, this->outputCsiData(), header->csiDataSize);
+}
 
-    if (this->format == RATE_MCS_HE_MSK && this->rawHeaderData.numSubCarriers == 1992)
+void Csi::fixCsiBug()
+{
+    if (!this->layout || !this->layout->firmwareGapLength || this->numSubCarriers != this->layout->numSubCarriers + this->layout->firmwareGapLength)
     {
         return;
     }
-    else if (this->format == RATE_MCS_HE_MSK)
-    {
-        newSubcarrierSize = 1992;
-    }
 
-    for (uint32_t i = 0; i < this->rawHeaderData.csiDataSize; i = i + 4)
-    {
-        if (format == RATE_MCS_VHT_MSK)
-        {
-            if (i > (241 * 4) && i < (256 * 4)) // Fix the firmware bug
-                continue;
-        }
-    }
-
-    uint32_t newTotalSize = newSubcarrierSize * 4 *this->numRx * this->numTx;
-    uint8_t fixedCsiData[newTotalSize];
+    const uint32_t gapStart = this->layout->firmwareGapStart;
+    const uint32_t gapEnd = gapStart + this->layout->firmwareGapLength;
+    const uint32_t newTotalSize = this->layout->numSubCarriers * 4 * this->numRx * this->numTx;
+    uint8_t *fixedCsiData = static_cast<uint8_t *>(this->resource->allocate(newTotalSize));
 
     uint32_t newIndex = 0;
     uint32_t oldIndex = 0;
@@ -143,40 +165,25 @@ void Csi::fixCsiBug()
     {
         for (uint32_t tx = 0; tx < this->numTx; tx++)
         {
-            for (uint32_t n = 0; n < this->numSubCarriers; n++)
-            {
-                if (this->format == RATE_MCS_VHT_MSK)
-                {
-                    if (n > 241 && n < 256)
-                    {
-                        oldIndex += 4;
-                        continue;
-                    }
-                }
-                if (this->format == RATE_MCS_HE_MSK)
-                {
-                    if (n > 995 && n < 1024)
-                    {
-                        oldIndex += 4;
-                        continue;
-                    }
-                }
-                memcpy(&fixedCsiData[newIndex], &this->rawCsiData[oldIndex], 4);
-                oldIndex += 4;
-                newIndex += 4;
-            }
+            // Fix the firmware bug, skip the subcarriers inside the gap
+            memcpy(&fixedCsiData[newIndex], &this->rawCsiData[oldIndex], gapStart * 4);
+            newIndex += gapStart * 4;
+            oldIndex += gapEnd * 4;
+            memcpy(&fixedCsiData[newIndex], &this->rawCsiData[oldIndex], (this->numSubCarriers - gapEnd) * 4);
+            newIndex += (this->numSubCarriers - gapEnd) * 4;
+            oldIndex += (this->numSubCarriers - gapEnd) * 4;
         }
     }
 
-    this->numSubCarriers = newSubcarrierSize;
+    this->numSubCarriers = this->layout->numSubCarriers;
     this->rawHeaderData.numSubCarriers = this->numSubCarriers;
     this->rawHeaderData.csiDataSize = newTotalSize;
-    delete this->rawCsiData;
-    this->rawCsiData = new uint8_t[newTotalSize];
-    memcpy(this->rawCsiData, fixedCsiData, newTotalSize);
+    this->resource->deallocate(this->rawCsiData, this->rawCsiCapacity);
+    this->rawCsiData = fixedCsiData;
+    this->rawCsiCapacity = newTotalSize;
 }
 
-void Csi::processRawCsi()
+void Csi::processRawCsi(bool decode)
 {
     this->numRx = this->rawHeaderData.numRx;
     this->numTx = this->rawHeaderData.numTx;
@@ -184,125 +191,131 @@ void Csi::processRawCsi()
 
     this->format = this->rawHeaderData.rateNflag & RATE_MCS_MOD_TYPE_MSK;
     this->channelWidth = this->rawHeaderData.rateNflag & RATE_MCS_CHAN_WIDTH_MSK;
-    
+    this->layout = getSubcarrierLayout(this->format, this->channelWidth);
+    this->processed = false;
+
     this->fixCsiBug();
+    if (decode)
+    {
+        this->reset();
+    }
+}
+
+void Csi::reset()
+{
+    // Stages may change the shape, e.g. CsiRatioStage replaces chains by chain pairs and ResampleStage the grid
+    this->numRx = this->rawHeaderData.numRx;
+    this->numTx = this->rawHeaderData.numTx;
+    this->numSubCarriers = this->rawHeaderData.numSubCarriers;
+    this->layout = getSubcarrierLayout(this->format, this->channelWidth);
+    if (this->layout && this->layout->numSubCarriers != this->numSubCarriers)
+    {
+        this->layout = nullptr;
+    }
 
-    
+    const uint32_t size = this->rawHeaderData.csiDataSize / 4;
+    this->csi.resize(size);
+    this->magnitude.resize(size);
+    this->phase.resize(size);
 
-    for (uint32_t i = 0; i < this->rawHeaderData.csiDataSize; i = i + 4)
+    for (uint32_t n = 0; n < size; n++)
     {
+        const uint32_t i = n * 4;
         int16_t real = this->rawCsiData[i] | this->rawCsiData[i + 1] << 8;
         int16_t imag = this->rawCsiData[i + 2] | this->rawCsiData[i + 3] << 8;
 
-
-        /* if (format == RATE_MCS_VHT_MSK)
-        {
-            if (i > (241 * 4) && i < (256 * 4)) // Fix the firmware bug
-                continue;
-        } */
-
         const std::complex<double> c(real, imag);
-        this->csi.push_back(c);
-        this->magnitude.push_back(std::abs(c));
-        this->phase.push_back(std::arg(c));
+        this->csi[n] = c;
+        this->magnitude[n] = std::abs(c);
+        this->phase[n] = std::arg(c);
     }
+    this->cir.clear();
+    this->paths.clear();
+    this->processedKey = 0;
+    this->processed = false;
 }
 
-void Csi::backup()
+// Processed CSI as int16 IQ (saturated) in a buffer of its own, raw data is kept for reset()
+void Csi::encodeProcessed()
 {
-    if (this->csiBackup.empty())
+    const uint32_t size = this->csi.size();
+    if (size * 4 > this->processedCsiCapacity)
     {
-        this->csiBackup = this->csi;
+        if (this->processedCsiData)
+        {
+            this->resource->deallocate(this->processedCsiData, this->processedCsiCapacity);
+        }
+        this->processedCsiData = static_cast<uint8_t *>(this->resource->allocate(size * 4));
+        this->processedCsiCapacity = size * 4;
     }
-}
 
-void Csi::restore()
-{
-    this->csi = this->csiBackup;
-    this->recalcMagnitudePhase();
+    auto saturate = [](double v)
+    {
+        return (int16_t)std::lround(std::clamp(v, (double)INT16_MIN, (double)INT16_MAX));
+    };
+    for (uint32_t n = 0; n < size; n++)
+    {
+        const int16_t real = saturate(this->csi[n].real());
+        const int16_t imag = saturate(this->csi[n].imag());
+        this->processedCsiData[n * 4] = real & 0xff;
+        this->processedCsiData[n * 4 + 1] = (real >> 8) & 0xff;
+        this->processedCsiData[n * 4 + 2] = imag & 0xff;
+        this->processedCsiData[n * 4 + 3] = (imag >> 8) & 0xff;
+    }
+
+    this->processedHeaderData = this->rawHeaderData;
+    this->processedHeaderData.csiDataSize = size * 4;
+    this->processedHeaderData.numRx = this->numRx;
+    this->processedHeaderData.numTx = this->numTx;
+    this->processedHeaderData.numSubCarriers = this->numSubCarriers;
+    this->processed = true;
 }
 
 void Csi::magnitudePhaseToComplex()
 {
-    for (uint32_t i = 0; i < this->csi.size(); i++)
+    uint32_t chains = this->numRx * this->numTx;
+    uint32_t subcarriers = this->numSubCarriers;
+    if (chains * subcarriers != this->csi.size())
     {
-        this->csi[i].real(this->magnitude[i] * cos(this->phase[i]));
-        this->csi[i].imag(this->magnitude[i] * sin(this->phase[i]));
+        chains = 1;
+        subcarriers = this->csi.size();
     }
+
+    shapeKernels::dispatch(chains, subcarriers, [this](auto shape)
+                           { shapeKernels::polarToComplex(shape, this->magnitude.data(), this->phase.data(), this->csi.data()); });
 }
 
 void Csi::recalcMagnitudePhase()
 {
-    this->magnitude.clear();
-    this->phase.clear();
-    for (std::complex<double> c : this->csi)
+    this->magnitude.resize(this->csi.size());
+    this->phase.resize(this->csi.size());
+    for (uint32_t i = 0; i < this->csi.size(); i++)
     {
-        this->magnitude.push_back(std::abs(c));
-        this->phase.push_back(std::arg(c));
+        this->magnitude[i] = std::abs(this->csi[i]);
+        this->phase[i] = std::arg(this->csi[i]);
     }
-    //this->unwrapPhase();
 }
 
-const std::vector<uint32_t> Csi::getPilotIndices()
+// Transmitter MAC packed into the low 48 bits, used as a key of per transmitter state
+uint64_t Csi::getSourceMac() const
 {
-    switch (this->format)
+    uint64_t mac = 0;
+    for (uint8_t byte : this->rawHeaderData.srcMac)
     {
-    case RATE_MCS_CCK_MSK: // VERY OLD FORMAT NOT USED NOW
-        break;
-    case RATE_MCS_LEGACY_OFDM_MSK:
-        return this->NO_NHT_20_PILOT_INDICES;
-        break;
-    case RATE_MCS_HT_MSK:
-        switch (channelWidth)
-        {
-        case RATE_MCS_CHAN_WIDTH_20:
-            return HT_VHT_20_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_40:
-            return HT_VHT_40_PILOT_INDICES;
-            break;
-        }
-        break;
-    case RATE_MCS_VHT_MSK:
-        switch (this->channelWidth)
-        {
-        case RATE_MCS_CHAN_WIDTH_20:
-            return HT_VHT_20_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_40:
-            return HT_VHT_40_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_80:
-            return VHT_80_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_160:
-            return VHT_160_PILOT_INDICES;
-            break;
-        }
-        break;
-    case RATE_MCS_HE_MSK:
-        switch (channelWidth)
-        {
-        case RATE_MCS_CHAN_WIDTH_20:
-            return HE_20_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_40:
-            return HE_40_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_80:
-            return HE_80_PILOT_INDICES;
-            break;
-        case RATE_MCS_CHAN_WIDTH_160:
-            return HE_160_PILOT_INDICES;
-            break;
-        }
-        break;
-    case RATE_MCS_EHT_MSK:
-        // TODO WiFi 7
-        break;
+        mac = (mac << 8) | byte;
     }
-    std::vector<uint32_t> v;
-    return v;
+    return mac;
+}
+
+uint8_t *Csi::getRawCsiData() const
+{
+    return this->rawCsiData;
+}
+
+// Bytes held by the frame, decoded vectors included
+size_t Csi::getMemoryUsage() const
+{
+    return sizeof(Csi) + this->rawCsiCapacity + this->processedCsiCapacity + (this->csi.capacity() + this->cir.capacity()) * sizeof(std::complex<double>) + (this->magnitude.capacity() + this->phase.capacity()) * sizeof(double) + this->paths.capacity() * sizeof(PathEstimate);
 }
 
 double Csi::constrainAngle(double x){
@@ -324,27 +337,14 @@ double Csi::angleDiff(double a,double b){
     return dif - M_PI;
 }
 
-double Csi::unwrap(double previousAngle,double newAngle){
-    float d = newAngle - previousAngle;
-    d = d > M_PI ? d - 2 * M_PI : (d < -M_PI ? d + 2 * M_PI : d);
-    return previousAngle + d;
-
-    //return previousAngle - angleDiff(newAngle,angleConv(previousAngle));
-}
-
 void Csi::unwrapPhase()
 {
-    uint32_t offset = 0;
-    for (uint32_t rx = 0; rx < this->numRx; rx++)
+    if (this->numSubCarriers < 2 || this->phase.size() < this->numRx * this->numTx * this->numSubCarriers)
     {
-        for (uint32_t tx = 0; tx < this->numTx; tx++)
-        {
-            for (uint32_t n = 1; n < this->numSubCarriers; n++)
-            {
-                uint32_t index = n + offset;
-                this->phase[index] = this->unwrap(this->phase[index - 1], this->phase[index]);
-            }
-            offset += this->numSubCarriers;
-        }
+        return;
     }
+
+    std::vector<double> correction(this->numSubCarriers);
+    shapeKernels::dispatch(this->numRx * this->numTx, this->numSubCarriers, [&](auto shape)
+                           { shapeKernels::unwrap(shape, this->phase.data(), correction.data()); });
 }
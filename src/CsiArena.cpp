@@ -0,0 +1,112 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CsiArena.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <new>
+
+CsiArena::CsiArena(size_t chunkSize) : chunkSize(chunkSize)
+{
+}
+
+CsiArena::~CsiArena()
+{
+    this->release();
+    for (Chunk &chunk : this->chunks)
+    {
+        ::operator delete(chunk.data, std::align_val_t(alignof(std::max_align_t)));
+    }
+}
+
+Csi *CsiArena::createCsi()
+{
+    void *memory = this->allocate(sizeof(Csi), alignof(Csi));
+    Csi *csi = new (memory) Csi(this);
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->frames.push_back(csi);
+    return csi;
+}
+
+void CsiArena::release()
+{
+    for (Csi *csi : this->frames)
+    {
+        csi->~Csi();
+    }
+    this->frames.clear();
+    this->current = 0;
+    this->offset = 0;
+}
+
+size_t CsiArena::getFrameCount() const
+{
+    return this->frames.size();
+}
+
+void CsiArena::printStatistics() const
+{
+    Logger::log(info) << "Frame arena: " << this->frames.size() << " frames, " << this->allocations << " allocations served, "
+                      << this->chunkAllocations << " chunks (" << this->chunkBytes / (1 << 20) << " MiB) from heap\n";
+}
+
+void *CsiArena::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->allocations++;
+    if (!this->chunks.empty())
+    {
+        size_t aligned = (this->offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= this->chunks[this->current].size)
+        {
+            this->offset = aligned + bytes;
+            return this->chunks[this->current].data + aligned;
+        }
+
+        // Next chunk left from before the last release
+        if (this->current + 1 < this->chunks.size() && bytes <= this->chunks[this->current + 1].size)
+        {
+            this->current++;
+            this->offset = bytes;
+            return this->chunks[this->current].data;
+        }
+    }
+
+    // Chunks start aligned to max_align_t, larger alignments are not used by frames
+    Chunk chunk;
+    chunk.size = std::max(this->chunkSize, bytes);
+    chunk.data = static_cast<uint8_t *>(::operator new(chunk.size, std::align_val_t(alignof(std::max_align_t))));
+    this->chunkAllocations++;
+    this->chunkBytes += chunk.size;
+
+    const size_t position = this->chunks.empty() ? 0 : this->current + 1;
+    this->chunks.insert(this->chunks.begin() + position, chunk);
+    this->current = position;
+    this->offset = bytes;
+    return chunk.data;
+}
+
+void CsiArena::do_deallocate(void *p, size_t bytes, size_t alignment)
+{
+}
+
+bool CsiArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
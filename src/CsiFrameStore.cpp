@@ -0,0 +1,283 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CsiFrameStore.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <ios>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+CsiFrameStore::CsiFrameStore(size_t cacheSize, uint32_t prefetch) : cacheSize(std::max<size_t>(1, cacheSize)), prefetch(prefetch)
+{
+    if (this->prefetch)
+    {
+        this->prefetcher = std::thread(&CsiFrameStore::prefetchLoop, this);
+    }
+}
+
+CsiFrameStore::~CsiFrameStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->requested.notify_all();
+    if (this->prefetcher.joinable())
+    {
+        this->prefetcher.join();
+    }
+    this->close();
+}
+
+void CsiFrameStore::open(const std::string &fileName)
+{
+    this->close();
+
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
+    }
+    struct stat status;
+    if (fstat(fd, &status) == -1)
+    {
+        ::close(fd);
+        throw std::ios_base::failure("Stat file failed: " + std::string(std::strerror(errno)));
+    }
+    if (status.st_size == 0)
+    {
+        // Nothing to map, a store without frames
+        ::close(fd);
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->generation++;
+        return;
+    }
+    void *memory = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        throw std::ios_base::failure("Map file failed: " + std::string(std::strerror(errno)));
+    }
+    // Without prefetch the store is read front to back, e.g. by batch processing
+    madvise(memory, status.st_size, this->prefetch ? MADV_RANDOM : MADV_SEQUENTIAL);
+
+    std::vector<uint64_t> offsets;
+    uint64_t position = 0;
+    const uint8_t *data = static_cast<const uint8_t *>(memory);
+    while (position + CSI_HEADER_LENGTH <= (uint64_t)status.st_size)
+    {
+        uint32_t csiDataSize;
+        memcpy(&csiDataSize, data + position, sizeof(csiDataSize));
+        if (position + CSI_HEADER_LENGTH + csiDataSize > (uint64_t)status.st_size)
+        {
+            break; // truncated last frame
+        }
+        offsets.push_back(position);
+        position += CSI_HEADER_LENGTH + csiDataSize;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->mapped = data;
+    this->mappedSize = status.st_size;
+    this->offsets.swap(offsets);
+    this->generation++;
+}
+
+void CsiFrameStore::close()
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->requests.clear();
+    this->decoded.wait(lock, [this]
+                       { return !this->decoding; });
+    this->lru.clear();
+    this->cached.clear();
+    this->cachedBytes = 0;
+    this->offsets.clear();
+    this->offsets.shrink_to_fit();
+    if (this->mapped)
+    {
+        munmap(const_cast<uint8_t *>(this->mapped), this->mappedSize);
+        this->mapped = nullptr;
+        this->mappedSize = 0;
+    }
+    this->generation++;
+}
+
+void CsiFrameStore::setPipeline(const std::string &spec)
+{
+    this->pipeline = ProcessingPipeline(spec);
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->spec = spec;
+    this->requests.clear();
+    this->lru.clear();
+    this->cached.clear();
+    this->cachedBytes = 0;
+    this->generation++;
+}
+
+size_t CsiFrameStore::size() const
+{
+    return this->offsets.size();
+}
+
+const uint8_t *CsiFrameStore::getRawFrame(size_t index) const
+{
+    return this->mapped + this->offsets[index];
+}
+
+size_t CsiFrameStore::getMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->offsets.capacity() * sizeof(uint64_t) + this->cachedBytes;
+}
+
+size_t CsiFrameStore::getMappedSize() const
+{
+    return this->mappedSize;
+}
+
+std::shared_ptr<Csi> CsiFrameStore::get(size_t index)
+{
+    std::shared_ptr<Csi> csi;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto it = this->cached.find(index);
+        if (it != this->cached.end())
+        {
+            this->lru.splice(this->lru.begin(), this->lru, it->second);
+            csi = it->second->second;
+        }
+    }
+
+    if (!csi)
+    {
+        csi = this->decode(this->getRawFrame(index), this->pipeline);
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->insert(index, csi);
+    }
+    this->requestNeighbours(index);
+    return csi;
+}
+
+std::shared_ptr<Csi> CsiFrameStore::decode(const uint8_t *frame, ProcessingPipeline &pipeline) const
+{
+    std::shared_ptr<Csi> csi = std::make_shared<Csi>();
+    csi->loadFromMemory(const_cast<uint8_t *>(frame));
+    pipeline.process(*csi);
+    return csi;
+}
+
+// Called with mutex held
+void CsiFrameStore::insert(size_t index, const std::shared_ptr<Csi> &csi)
+{
+    if (this->cached.count(index))
+    {
+        return;
+    }
+
+    this->lru.emplace_front(index, csi);
+    this->cached[index] = this->lru.begin();
+    this->cachedBytes += csi->getMemoryUsage();
+    while (this->lru.size() > this->cacheSize)
+    {
+        this->cachedBytes -= this->lru.back().second->getMemoryUsage();
+        this->cached.erase(this->lru.back().first);
+        this->lru.pop_back();
+    }
+}
+
+void CsiFrameStore::requestNeighbours(size_t index)
+{
+    if (!this->prefetch)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        // Only the neighbourhood of the latest access is worth decoding
+        this->requests.clear();
+        for (uint32_t distance = 1; distance <= this->prefetch; distance++)
+        {
+            if (index + distance < this->offsets.size() && !this->cached.count(index + distance))
+            {
+                this->requests.push_back(index + distance);
+            }
+            if (index >= distance && !this->cached.count(index - distance))
+            {
+                this->requests.push_back(index - distance);
+            }
+        }
+    }
+    this->requested.notify_one();
+}
+
+void CsiFrameStore::prefetchLoop()
+{
+    ProcessingPipeline pipeline;
+    std::string pipelineSpec;
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (true)
+    {
+        this->requested.wait(lock, [this]
+                             { return this->stopping || !this->requests.empty(); });
+        if (this->stopping)
+        {
+            return;
+        }
+
+        const size_t index = this->requests.front();
+        this->requests.pop_front();
+        if (this->cached.count(index) || index >= this->offsets.size())
+        {
+            continue;
+        }
+        const uint64_t generation = this->generation;
+        const uint8_t *frame = this->getRawFrame(index);
+        if (pipelineSpec != this->spec)
+        {
+            // setPipeline() already validated the spec
+            pipelineSpec = this->spec;
+            pipeline = ProcessingPipeline(pipelineSpec);
+        }
+
+        this->decoding = true;
+        lock.unlock();
+        std::shared_ptr<Csi> csi;
+        try
+        {
+            csi = this->decode(frame, pipeline);
+        }
+        catch (const std::exception &)
+        {
+            // get() decodes the frame again and reports the error to the caller
+        }
+        lock.lock();
+        this->decoding = false;
+        this->decoded.notify_all();
+        if (csi && generation == this->generation)
+        {
+            this->insert(index, csi);
+        }
+    }
+}
@@ -19,187 +19,183 @@
 #include "CsiProcessor.h"
 #include "main.h"
 #include "Logger.h"
-#include "interpolation.h"
 #include "Arguments.h"
+#include "BatchExecutor.h"
+#include "CsiArena.h"
 
+#include <deque>
 #include <fstream>
+#include <mutex>
 #include <numeric>
 #include <filesystem>
 #include <cstring>
 
-bool CsiProcessor::loadCsi()
+// Frames are decoded from the mapped file chunk by chunk into reused arenas, so only frames in flight are held in memory.
+// Output of the same file and pipeline is served from the processed cache unless --no-cache
+// or stages write records of their own, which a hit would skip.
+void CsiProcessor::saveCsi(const CsiFrameStore &store)
 {
-    this->clearState();
-    std::ifstream ifs(Arguments::arguments.inputFile, std::ios::binary);
-
-    ifs.seekg (0, ifs.end);
-    int length = ifs.tellg();
-    ifs.seekg (0, ifs.beg);
-    int currentPosition = 0;
-
-    while (currentPosition < length)
+    std::unique_ptr<ProcessedCache> cache;
+    std::string key;
+    if (!Arguments::arguments.noCache && !this->pipeline.hasOutput())
     {
-        uint32_t csiDataSize;
-
-        ifs.read((char *)&csiDataSize, 4);
-        ifs.seekg(currentPosition, ifs.beg);
+        try
+        {
+            cache = std::make_unique<ProcessedCache>(Arguments::arguments.cacheDir, Arguments::arguments.cacheSize * 1024 * 1024);
+            key = ProcessedCache::makeKey(Arguments::arguments.inputFile, store, this->pipeline.getSpec());
+        }
+        catch (const std::exception &e)
+        {
+            Logger::log(error) << "Processed cache disabled: " << e.what() << '\n';
+            cache.reset();
+        }
+    }
 
-        uint8_t rawData[CSI_HEADER_LENGTH + csiDataSize];
-        ifs.read((char *)rawData, CSI_HEADER_LENGTH + csiDataSize);
-        Csi *c = new Csi();
-        c->loadFromMemory(rawData);
-        this->csiData.push_back(c);
-        currentPosition = ifs.tellg();
-        //break;
+    if (cache)
+    {
+        std::ofstream outfile;
+        outfile.open(Arguments::arguments.outputFile, std::ios_base::app | std::ios::binary);
+        if (outfile.fail())
+        {
+            throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
+        }
+        uint64_t bytes = 0;
+        if (cache->serve(key, outfile, bytes))
+        {
+            outfile.close();
+            Logger::log(info) << "Processed output served from cache, " << bytes << " bytes\n";
+            std::filesystem::permissions(Arguments::arguments.outputFile, std::filesystem::perms::all & ~(std::filesystem::perms::owner_exec | std::filesystem::perms::group_exec | std::filesystem::perms::others_exec), std::filesystem::perm_options::add);
+            return;
+        }
     }
 
-    Logger::log(info) << "Csi loaded \n";
-    return true;
-}
+    std::unique_ptr<ProcessedCache::Writer> cacheWriter;
+    if (cache)
+    {
+        try
+        {
+            cacheWriter = std::make_unique<ProcessedCache::Writer>(*cache, key);
+        }
+        catch (const std::exception &e)
+        {
+            Logger::log(error) << "Processed cache disabled: " << e.what() << '\n';
+        }
+    }
 
-void CsiProcessor::saveCsi()
-{
     std::ofstream outfile;
     outfile.open(Arguments::arguments.outputFile, std::ios_base::app | std::ios::binary);
     if (outfile.fail())
     {
         throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
     }
-    this->process(*(this->csiData[0]));
-    
-    for (Csi *c : this->csiData) {
-        this->process(*c);
-        c->rawHeaderData.csiDataSize = sizeof(std::complex<double>) * c->csi.size();
-        outfile.write(reinterpret_cast<char *>(&c->rawHeaderData), sizeof(RawHeaderData));
-        outfile.write(reinterpret_cast<char *>(c->csi.data()), c->rawHeaderData.csiDataSize);
-    }
-    outfile.close();
-    std::filesystem::permissions(Arguments::arguments.outputFile, std::filesystem::perms::all & ~(std::filesystem::perms::owner_exec | std::filesystem::perms::group_exec | std::filesystem::perms::others_exec), std::filesystem::perm_options::add);
-}
-
-CsiProcessor::~CsiProcessor()
-{
-    this->clearState();
-}
-
-void CsiProcessor::clearState()
-{
-    if (this->csiData.empty())
-    {
-        return;
-    }
-    
-    for (Csi *c : this->csiData) {
-        delete c;
-    }
-}
 
-void CsiProcessor::interpolate(Csi &csi, processor type)
-{
-    const std::vector<uint32_t> pilotIndices = csi.getPilotIndices();
-    uint32_t offset = 0;
-    for (uint32_t rx = 0; rx < csi.numRx; rx++)
-    {
-        for (uint32_t tx = 0; tx < csi.numTx; tx++)
+    // Every chunk in flight is loaded into an arena of its own, released once the writer is done with it.
+    // The reader and the writer see chunks in the same order, so the oldest arena in use is the written one.
+    std::mutex arenaMutex;
+    std::vector<std::unique_ptr<CsiArena>> freeArenas;
+    std::deque<std::unique_ptr<CsiArena>> usedArenas;
+    size_t nextFrame = 0;
+    BatchExecutor executor(this->pipeline.getSpec(), Arguments::arguments.threads);
+    uint64_t bytesWritten = 0;
+    executor.run(
+        [&store, &nextFrame, &arenaMutex, &freeArenas, &usedArenas](std::vector<Csi *> &chunk, uint32_t chunkSize)
         {
-            for (uint32_t pilotIndice : pilotIndices) {
-                uint32_t index = pilotIndice + offset;
-                if (type == processor::interpolateLinear)
-                {
-                    csi.magnitude[index] = interpolation::linearInterpolate(csi.magnitude[index - 1], csi.magnitude[index + 1], 0.5);
-                    csi.phase[index] = interpolation::linearInterpolate(csi.phase[index - 1], csi.phase[index + 1], 0.5);
-                }
-                else if(type == processor::interpolateCubic)
+            std::unique_ptr<CsiArena> arena;
+            {
+                std::lock_guard<std::mutex> lock(arenaMutex);
+                if (freeArenas.empty())
                 {
-                    csi.magnitude[index] = interpolation::cubicInterpolate(csi.magnitude[index - 2], csi.magnitude[index - 1], csi.magnitude[index + 1], csi.magnitude[index + 2], 0.5);
-                    csi.phase[index] = interpolation::cubicInterpolate(csi.phase[index - 2], csi.phase[index - 1], csi.phase[index + 1], csi.phase[index + 2], 0.5);
+                    // Up to a few chunks per thread are in flight, arenas start small and keep what larger frames add
+                    arena = std::make_unique<CsiArena>(CSI_ARENA_CHUNK_SIZE / 8);
                 }
-                else if(type == processor::interpolateCosine)
+                else
                 {
-                    csi.magnitude[index] = interpolation::cosineInterpolate(csi.magnitude[index - 1], csi.magnitude[index + 1], 0.5);
-                    csi.phase[index] = interpolation::cosineInterpolate(csi.phase[index - 1], csi.phase[index + 1], 0.5);
+                    arena = std::move(freeArenas.back());
+                    freeArenas.pop_back();
                 }
             }
-            offset += csi.numSubCarriers;
-        }
-    }
-
-    csi.magnitudePhaseToComplex();
-}
 
-void CsiProcessor::process(Csi &csi)
-{
-    csi.backup();
-    csi.restore();
+            chunk.clear();
+            while (nextFrame < store.size() && chunk.size() < chunkSize)
+            {
+                Csi *csi = arena->createCsi();
+                csi->loadFromMemory(const_cast<uint8_t *>(store.getRawFrame(nextFrame++)));
+                chunk.push_back(csi);
+            }
 
-    if (Arguments::arguments.processors[processor::interpolateLinear])
-    {
-        this->interpolate(csi, processor::interpolateLinear);
-    } 
-    else if (Arguments::arguments.processors[processor::interpolateCubic])
+            std::lock_guard<std::mutex> lock(arenaMutex);
+            if (chunk.empty())
+            {
+                freeArenas.push_back(std::move(arena));
+                return false;
+            }
+            usedArenas.push_back(std::move(arena));
+            return true;
+        },
+        [&outfile, &bytesWritten, &cacheWriter, &arenaMutex, &freeArenas, &usedArenas](std::vector<Csi *> &chunk)
+        {
+            for (Csi *c : chunk)
+            {
+                bytesWritten += CsiProcessor::writeProcessed(outfile, *c, cacheWriter.get());
+            }
+            std::lock_guard<std::mutex> lock(arenaMutex);
+            usedArenas.front()->release();
+            freeArenas.push_back(std::move(usedArenas.front()));
+            usedArenas.pop_front();
+        });
+    outfile.close();
+    executor.printStatistics(bytesWritten);
+    if (Arguments::arguments.verbose)
     {
-        this->interpolate(csi, processor::interpolateCubic);
+        uint64_t allocations = 0;
+        uint64_t chunkAllocations = 0;
+        uint64_t chunkBytes = 0;
+        for (const std::unique_ptr<CsiArena> &arena : freeArenas)
+        {
+            allocations += arena->allocations;
+            chunkAllocations += arena->chunkAllocations;
+            chunkBytes += arena->chunkBytes;
+        }
+        Logger::log(info) << "Frame arenas: " << freeArenas.size() << " arenas, " << allocations << " allocations served, "
+                          << chunkAllocations << " chunks (" << chunkBytes / (1 << 20) << " MiB) from heap\n";
     }
-    else if (Arguments::arguments.processors[processor::interpolateCosine])
+    std::filesystem::permissions(Arguments::arguments.outputFile, std::filesystem::perms::all & ~(std::filesystem::perms::owner_exec | std::filesystem::perms::group_exec | std::filesystem::perms::others_exec), std::filesystem::perm_options::add);
+    if (cacheWriter)
     {
-        this->interpolate(csi, processor::interpolateCosine);
+        cacheWriter->commit();
     }
-
-    if (Arguments::arguments.processors[processor::phaseCalibrationLinearTransform])
-    {
-        this->phaseCalibLinearTransform(csi);
-    } 
 }
 
-//WiFi-Based Real-Time Calibration-Free Passive Human Motion Detection
-void CsiProcessor::phaseCalibLinearTransform(Csi &csi)
+// Header with shape and csiDataSize of the processed CSI followed by complex<double> values, returns bytes written
+uint64_t CsiProcessor::writeProcessed(std::ostream &out, const Csi &csi, ProcessedCache::Writer *cacheWriter)
 {
-    /* double a = (csi.phase.back() - csi.phase[0]) / (csi.phase.size());
-    double b = std::reduce(csi.phase.begin(), csi.phase.end()) / csi.phase.size();
-    
-    for (uint32_t i = 0; i < csi.phase.size(); i++) {
-        csi.phase[i] = csi.phase[i] - (a*(i + 1) + b);
-    } */
-
-    uint32_t offset = 0;
-    //double sk[] = {-26, -25, -24, -23, -22, -21, -20, -19, -18, -17, -16, -15, -14, -13, -12, -11, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26};
-
-    std::vector<int> sk;
-    for (int i = (csi.numSubCarriers / 2); i >= 0 ; i--)
-    {
-        sk.push_back(-i);
-    }
-    for (uint32_t i = 1; i <= (csi.numSubCarriers / 2) ; i++)
+    // Stages such as csiRatio and resample change the shape, readers cut the values by it
+    RawHeaderData header = csi.rawHeaderData;
+    header.csiDataSize = sizeof(std::complex<double>) * csi.csi.size();
+    header.numRx = csi.numRx;
+    header.numTx = csi.numTx;
+    header.numSubCarriers = csi.numSubCarriers;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(RawHeaderData));
+    out.write(reinterpret_cast<const char *>(csi.csi.data()), header.csiDataSize);
+    if (cacheWriter)
     {
-        sk.push_back(i);
+        cacheWriter->write(reinterpret_cast<const char *>(&header), sizeof(RawHeaderData));
+        cacheWriter->write(reinterpret_cast<const char *>(csi.csi.data()), header.csiDataSize);
     }
-    
-    
-    csi.unwrapPhase();
-
-    for (uint32_t rx = 0; rx < csi.numRx; rx++)
-    {
-        for (uint32_t tx = 0; tx < csi.numTx; tx++)
-        {
-            uint32_t firstIndex = offset;
-            uint32_t lastIndex = offset + (csi.numSubCarriers - 1);
-            
-            double sum = 0;
-            for (uint32_t i = firstIndex; i <= lastIndex; i++) {
-                sum += csi.phase[i];
-            }
+    return sizeof(RawHeaderData) + header.csiDataSize;
+}
 
-            double a = (csi.phase[lastIndex] - csi.phase[firstIndex]) / (sk.back() - sk[0]);
-            double b = sum / csi.numSubCarriers;
+void CsiProcessor::setPipeline(const std::string &spec)
+{
+    this->pipeline = ProcessingPipeline(spec);
+}
 
-            uint32_t k = 0;
-            for (uint32_t i = firstIndex; i <= lastIndex; i++) {
-                csi.phase[i] = csi.phase[i] - a*sk[k]  - b;
-                k++;
-            }
+void CsiProcessor::process(std::vector<Csi *> &batch)
+{
+    this->pipeline.process(batch);
+}
 
-            offset += csi.numSubCarriers;
-        }
-    }
-    csi.magnitudePhaseToComplex();
-}
\ No newline at end of file
+void CsiProcessor::process(Csi &csi)
+{
+    this->pipeline.process(csi);
+}
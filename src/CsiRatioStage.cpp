@@ -0,0 +1,138 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CsiRatioStage.h"
+#include "MatrixKernels.h"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+CsiRatioStage::CsiRatioStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "pairs")
+        {
+            std::istringstream pairStream(value);
+            std::string pair;
+            while (std::getline(pairStream, pair, '+'))
+            {
+                size_t separator = pair.find('-');
+                if (separator == std::string::npos)
+                {
+                    throw std::invalid_argument("Chain pair has to be a-b: " + pair);
+                }
+                this->pairs.emplace_back(std::stoul(pair.substr(0, separator)), std::stoul(pair.substr(separator + 1)));
+            }
+        }
+        else if (key == "mode")
+        {
+            if (value == "conj")
+            {
+                this->ratioMode = mode::conjugate;
+            }
+            else if (value == "ratio")
+            {
+                this->ratioMode = mode::ratio;
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown csiRatio mode: " + value);
+            }
+        }
+        else if (key == "scale")
+        {
+            this->scale = std::stod(value);
+        }
+        else if (key == "replace")
+        {
+            this->replace = true;
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of csiRatio: " + key);
+        }
+    }
+
+    if (this->pairs.empty())
+    {
+        this->pairs.emplace_back(0, 1);
+    }
+}
+
+const char *CsiRatioStage::name() const
+{
+    return "csiRatio";
+}
+
+void CsiRatioStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->combine(*csi);
+    }
+}
+
+void CsiRatioStage::combine(Csi &csi)
+{
+    const uint32_t chains = csi.numRx * csi.numTx;
+    for (const auto &[a, b] : this->pairs)
+    {
+        if (a >= chains || b >= chains)
+        {
+            return;
+        }
+    }
+
+    const uint32_t n = csi.numSubCarriers;
+    this->products.resize(this->pairs.size() * n);
+    for (uint32_t p = 0; p < this->pairs.size(); p++)
+    {
+        const std::complex<double> *x = &csi.csi[this->pairs[p].first * n];
+        const std::complex<double> *y = &csi.csi[this->pairs[p].second * n];
+        std::complex<double> *out = &this->products[p * n];
+        if (this->ratioMode == mode::conjugate)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                const double norm = std::sqrt(std::abs(x[i]) * std::abs(y[i]));
+                out[i] = matrixKernels::multiplyConj(x[i], y[i]) * (norm > 0 ? 1 / norm : 0.0);
+            }
+        }
+        else
+        {
+            // x / y = x * conj(y) / |y|^2
+            for (uint32_t i = 0; i < n; i++)
+            {
+                const double norm = std::norm(y[i]);
+                out[i] = matrixKernels::multiplyConj(x[i], y[i]) * (norm > 0 ? this->scale / norm : 0.0);
+            }
+        }
+    }
+
+    csi.csi.assign(this->products.begin(), this->products.end());
+    csi.numRx = this->pairs.size();
+    csi.numTx = 1;
+    csi.recalcMagnitudePhase();
+
+    if (this->replace)
+    {
+        csi.encodeProcessed();
+    }
+}
@@ -0,0 +1,178 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CsiReassembler.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+CsiReassembler::CsiReassembler(uint32_t maxFrames, uint32_t timeoutMs) : maxFrames(std::max(1u, maxFrames)), timeout(timeoutMs)
+{
+    this->finishedIds.resize(this->maxFrames * 4);
+}
+
+void CsiReassembler::addSink(const FrameSink &sink)
+{
+    this->sinks.push_back(sink);
+}
+
+bool CsiReassembler::push(const uint8_t *datagram, size_t size, TimePoint now)
+{
+    CsiChunkHeader header;
+    if (size < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, datagram, sizeof(header));
+    if (header.magic != CSI_CHUNK_MAGIC)
+    {
+        return false;
+    }
+
+    this->expire(now);
+
+    const uint32_t payloadSize = size - sizeof(header);
+    if (header.chunkCount == 0 || header.chunkIndex >= header.chunkCount || header.frameSize > CSI_REASSEMBLER_MAX_FRAME_SIZE ||
+        header.offset > header.frameSize || payloadSize > header.frameSize - header.offset)
+    {
+        this->invalidChunks++;
+        return true;
+    }
+
+    if (!this->started)
+    {
+        this->started = true;
+        this->firstFrameId = header.frameId;
+        this->lastFrameId = header.frameId;
+    }
+    // Ids wrap around, a difference below 2^31 is newer
+    if ((int32_t)(header.frameId - this->lastFrameId) > 0)
+    {
+        this->lastFrameId = header.frameId;
+    }
+
+    auto frame = this->frames.find(header.frameId);
+    if (frame == this->frames.end())
+    {
+        if (this->finished(header.frameId))
+        {
+            this->duplicateChunks++;
+            return true;
+        }
+        while (this->frames.size() >= this->maxFrames)
+        {
+            // Oldest by arrival of its first chunk, map order breaks when ids wrap
+            auto oldest = std::min_element(this->frames.begin(), this->frames.end(), [](const auto &a, const auto &b)
+                                           { return a.second.firstChunk < b.second.firstChunk; });
+            this->evictedFrames++;
+            this->finish(oldest);
+        }
+
+        PartialFrame partial;
+        if (!this->spareBuffers.empty())
+        {
+            partial.data.swap(this->spareBuffers.back());
+            this->spareBuffers.pop_back();
+        }
+        partial.data.resize(header.frameSize);
+        partial.received.assign(header.chunkCount, false);
+        partial.remaining = header.chunkCount;
+        partial.firstChunk = now;
+        frame = this->frames.emplace((uint32_t)header.frameId, std::move(partial)).first;
+    }
+
+    PartialFrame &partial = frame->second;
+    if (partial.data.size() != header.frameSize || partial.received.size() != header.chunkCount)
+    {
+        this->invalidChunks++;
+        return true;
+    }
+    if (partial.received[header.chunkIndex])
+    {
+        this->duplicateChunks++;
+        return true;
+    }
+    memcpy(partial.data.data() + header.offset, datagram + sizeof(header), payloadSize);
+    partial.received[header.chunkIndex] = true;
+    partial.remaining--;
+
+    if (partial.remaining == 0)
+    {
+        for (const FrameSink &sink : this->sinks)
+        {
+            sink(partial.data.data(), partial.data.size());
+        }
+        this->completedFrames++;
+        this->finish(frame);
+    }
+    return true;
+}
+
+void CsiReassembler::expire(TimePoint now)
+{
+    for (auto frame = this->frames.begin(); frame != this->frames.end();)
+    {
+        auto next = std::next(frame);
+        if (now - frame->second.firstChunk >= this->timeout)
+        {
+            this->timedOutFrames++;
+            this->finish(frame);
+        }
+        frame = next;
+    }
+}
+
+void CsiReassembler::finish(std::map<uint32_t, PartialFrame>::iterator frame)
+{
+    this->finishedIds[this->finishedCount++ % this->finishedIds.size()] = frame->first;
+    frame->second.data.clear();
+    this->spareBuffers.push_back(std::move(frame->second.data));
+    this->frames.erase(frame);
+}
+
+bool CsiReassembler::finished(uint32_t frameId) const
+{
+    const uint32_t count = std::min<uint32_t>(this->finishedCount, this->finishedIds.size());
+    return std::find(this->finishedIds.begin(), this->finishedIds.begin() + count, frameId) != this->finishedIds.begin() + count;
+}
+
+uint64_t CsiReassembler::getMissingFrames() const
+{
+    if (!this->started)
+    {
+        return 0;
+    }
+    const uint64_t seen = this->completedFrames + this->timedOutFrames + this->evictedFrames + this->frames.size();
+    const uint64_t span = (uint64_t)(uint32_t)(this->lastFrameId - this->firstFrameId) + 1;
+    return span > seen ? span - seen : 0;
+}
+
+void CsiReassembler::printStatistics()
+{
+    const uint64_t missing = this->getMissingFrames();
+    const uint64_t lost = this->timedOutFrames + this->evictedFrames + missing;
+    const uint64_t total = this->completedFrames + lost;
+    Logger::log(info) << "Reassembled " << this->completedFrames << " frames, lost " << lost << " (" << this->timedOutFrames << " timed out, " << this->evictedFrames << " evicted, "
+                      << missing << " missing)";
+    if (total)
+    {
+        Logger::log(info, true) << ", loss " << 100.0 * lost / total << " %";
+    }
+    Logger::log(info, true) << ", " << this->duplicateChunks << " duplicate and " << this->invalidChunks << " invalid chunks\n";
+}
@@ -0,0 +1,197 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DopplerStage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+DopplerStage::DopplerStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            this->windowSize = std::stoul(value);
+        }
+        else if (key == "hop")
+        {
+            this->hop = std::stoul(value);
+        }
+        else if (key == "group")
+        {
+            this->groupSize = std::stoul(value);
+        }
+        else if (key == "output")
+        {
+            this->output = RecordFile(value);
+            this->addSink([this](const DopplerFrame &frame)
+                          { this->output.write(&frame.header, sizeof(DopplerHeader), frame.power.data(), frame.power.size() * sizeof(float)); });
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of doppler: " + key);
+        }
+    }
+
+    if (this->hop == 0 || this->hop > this->windowSize)
+    {
+        throw std::invalid_argument("Doppler hop has to be between 1 and window size");
+    }
+    if (this->groupSize == 0)
+    {
+        throw std::invalid_argument("Doppler group has to be at least 1");
+    }
+
+    this->fft = &Fft::get(this->windowSize);
+    this->buffer.resize(this->windowSize);
+    this->window.resize(this->windowSize);
+    for (uint32_t i = 0; i < this->windowSize; i++)
+    {
+        this->window[i] = 0.5 - 0.5 * std::cos(2 * M_PI * i / this->windowSize);
+    }
+}
+
+const char *DopplerStage::name() const
+{
+    return "doppler";
+}
+
+bool DopplerStage::isSequential() const
+{
+    return true;
+}
+
+bool DopplerStage::hasOutput() const
+{
+    return this->output.isSet();
+}
+
+void DopplerStage::addSink(const DopplerSink &sink)
+{
+    this->sinks.push_back(sink);
+}
+
+void DopplerStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->update(*csi);
+    }
+}
+
+void DopplerStage::update(Csi &csi)
+{
+    Stream &stream = this->streams[csi.getSourceMac()];
+    const uint32_t chains = csi.numRx * csi.numTx;
+    const uint32_t slots = this->windowSize + this->hop;
+
+    // Format or antenna change of the transmitter starts a new history
+    if (stream.numChains != chains || stream.numSubCarriers != csi.numSubCarriers)
+    {
+        stream = Stream();
+        stream.numChains = chains;
+        stream.numSubCarriers = csi.numSubCarriers;
+        stream.history.resize(slots * chains * csi.numSubCarriers);
+        stream.timestamps.resize(slots);
+
+        const uint32_t groups = (csi.numSubCarriers + this->groupSize - 1) / this->groupSize;
+        memcpy(stream.frame.header.srcMac, csi.rawHeaderData.srcMac, sizeof(stream.frame.header.srcMac));
+        stream.frame.header.numChains = chains;
+        stream.frame.header.numGroups = groups;
+        stream.frame.header.numBins = this->windowSize;
+        stream.frame.power.resize(chains * groups * this->windowSize);
+    }
+
+    const uint32_t columns = chains * csi.numSubCarriers;
+    const uint32_t slot = stream.count % slots;
+    memcpy(&stream.history[slot * columns], csi.csi.data(), columns * sizeof(std::complex<double>));
+    stream.timestamps[slot] = csi.rawHeaderData.timestamp;
+    stream.count++;
+
+    if (stream.count >= this->windowSize && (stream.count - this->windowSize) % this->hop == 0)
+    {
+        // Previous window is always finished within one hop
+        stream.pending = true;
+        stream.pendingEnd = stream.count;
+        stream.nextColumn = 0;
+        std::fill(stream.frame.power.begin(), stream.frame.power.end(), 0.0f);
+    }
+
+    if (stream.pending)
+    {
+        this->transformColumns(stream, (columns + this->hop - 1) / this->hop);
+        if (stream.nextColumn == columns)
+        {
+            stream.pending = false;
+            this->emit(stream);
+        }
+    }
+}
+
+void DopplerStage::transformColumns(Stream &stream, uint32_t count)
+{
+    const uint32_t slots = this->windowSize + this->hop;
+    const uint32_t columns = stream.numChains * stream.numSubCarriers;
+    const uint32_t groups = stream.frame.header.numGroups;
+    const uint64_t first = stream.pendingEnd - this->windowSize;
+    const uint32_t half = this->windowSize / 2;
+
+    for (uint32_t n = 0; n < count && stream.nextColumn < columns; n++, stream.nextColumn++)
+    {
+        const uint32_t column = stream.nextColumn;
+        std::complex<double> mean = 0;
+        for (uint32_t t = 0; t < this->windowSize; t++)
+        {
+            this->buffer[t] = stream.history[((first + t) % slots) * columns + column];
+            mean += this->buffer[t];
+        }
+        mean /= (double)this->windowSize;
+
+        // Static paths end up in the DC bin, remove them before windowing
+        for (uint32_t t = 0; t < this->windowSize; t++)
+        {
+            this->buffer[t] = (this->buffer[t] - mean) * this->window[t];
+        }
+        this->fft->forward(this->buffer.data());
+
+        const uint32_t chain = column / stream.numSubCarriers;
+        const uint32_t group = (column % stream.numSubCarriers) / this->groupSize;
+        const uint32_t groupStart = group * this->groupSize;
+        const uint32_t groupCount = std::min(this->groupSize, stream.numSubCarriers - groupStart);
+        float *power = &stream.frame.power[(chain * groups + group) * this->windowSize];
+        for (uint32_t b = 0; b < this->windowSize; b++)
+        {
+            power[(b + half) % this->windowSize] += std::norm(this->buffer[b]) / groupCount;
+        }
+    }
+}
+
+void DopplerStage::emit(Stream &stream)
+{
+    const uint32_t slots = this->windowSize + this->hop;
+    stream.frame.header.firstTimestamp = stream.timestamps[(stream.pendingEnd - this->windowSize) % slots];
+    stream.frame.header.lastTimestamp = stream.timestamps[(stream.pendingEnd - 1) % slots];
+    for (DopplerSink &sink : this->sinks)
+    {
+        sink(stream.frame);
+    }
+    this->emittedFrames++;
+}
@@ -0,0 +1,440 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FeatureStage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+FeatureStage::FeatureStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "features")
+        {
+            std::istringstream featureStream(value);
+            std::string name;
+            while (std::getline(featureStream, name, '+'))
+            {
+                if (name == "mean")
+                {
+                    this->features.push_back(feature::amplitudeMean);
+                }
+                else if (name == "std")
+                {
+                    this->features.push_back(feature::amplitudeStd);
+                }
+                else if (name == "kurtosis")
+                {
+                    this->features.push_back(feature::amplitudeKurtosis);
+                }
+                else if (name == "doppler")
+                {
+                    this->features.push_back(feature::dopplerEnergy);
+                }
+                else if (name == "phase")
+                {
+                    this->features.push_back(feature::phaseDifference);
+                }
+                else
+                {
+                    throw std::invalid_argument("Unknown feature: " + name);
+                }
+            }
+        }
+        else if (key == "groups")
+        {
+            this->groups = std::stoul(value);
+        }
+        else if (key == "window")
+        {
+            this->window = std::stoul(value);
+        }
+        else if (key == "hop")
+        {
+            this->hop = std::stoul(value);
+        }
+        else if (key == "bands")
+        {
+            std::istringstream bandStream(value);
+            std::string band;
+            while (std::getline(bandStream, band, '+'))
+            {
+                size_t separator = band.find('-');
+                if (separator == std::string::npos)
+                {
+                    throw std::invalid_argument("Doppler band has to be a-b: " + band);
+                }
+                this->bands.emplace_back(std::stoul(band.substr(0, separator)), std::stoul(band.substr(separator + 1)));
+            }
+        }
+        else if (key == "output")
+        {
+            this->output = RecordFile(value);
+            this->addSink([this](const FeatureVector &vector)
+                          { this->output.write(&vector.header, sizeof(FeatureHeader), vector.values.data(), vector.values.size() * sizeof(float)); });
+        }
+        else if (key == "shm")
+        {
+            this->shmName = value;
+        }
+        else if (key == "capacity")
+        {
+            this->shmCapacity = std::stoul(value);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of features: " + key);
+        }
+    }
+
+    if (this->features.empty())
+    {
+        this->features = {feature::amplitudeMean, feature::amplitudeStd, feature::amplitudeKurtosis, feature::dopplerEnergy, feature::phaseDifference};
+    }
+    if (this->bands.empty())
+    {
+        this->bands = {{1, 2}, {3, 8}, {9, 32}};
+    }
+    if (this->hop == 0)
+    {
+        this->hop = this->window;
+    }
+    if (this->groups == 0 || this->window < 2 || this->hop > this->window || this->window % this->hop)
+    {
+        throw std::invalid_argument("Features need groups >= 1, window >= 2 and hop dividing window");
+    }
+
+    if (std::find(this->features.begin(), this->features.end(), feature::dopplerEnergy) != this->features.end())
+    {
+        for (const auto &[first, last] : this->bands)
+        {
+            if (first == 0 || first > last || last > this->window / 2)
+            {
+                throw std::invalid_argument("Doppler bands have to be within 1 and window / 2");
+            }
+        }
+        this->fft = &Fft::get(this->window);
+        this->buffer.resize(this->window);
+        this->hann.resize(this->window);
+        for (uint32_t i = 0; i < this->window; i++)
+        {
+            this->hann[i] = 0.5 - 0.5 * std::cos(2 * M_PI * i / this->window);
+        }
+    }
+
+    if (!this->shmName.empty())
+    {
+        this->addSink([this](const FeatureVector &vector)
+                      {
+            const uint32_t size = sizeof(FeatureHeader) + vector.values.size() * sizeof(float);
+            if (!this->shm)
+            {
+                this->shm = std::make_unique<SharedMemoryRing>(this->shmName, size, this->shmCapacity);
+            }
+            if (size != this->shm->getSlotSize())
+            {
+                return;
+            }
+            std::vector<char> record(size);
+            memcpy(record.data(), &vector.header, sizeof(FeatureHeader));
+            memcpy(record.data() + sizeof(FeatureHeader), vector.values.data(), vector.values.size() * sizeof(float));
+            this->shm->write(record.data(), size); });
+    }
+}
+
+const char *FeatureStage::name() const
+{
+    return "features";
+}
+
+bool FeatureStage::isSequential() const
+{
+    return true;
+}
+
+bool FeatureStage::hasOutput() const
+{
+    return this->output.isSet() || !this->shmName.empty();
+}
+
+void FeatureStage::addSink(const FeatureSink &sink)
+{
+    this->sinks.push_back(sink);
+}
+
+void FeatureStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->update(*csi);
+    }
+}
+
+void FeatureStage::reset(Stream &stream, const Csi &csi)
+{
+    const uint32_t chains = csi.numRx * csi.numTx;
+    const uint32_t cells = chains * this->groups;
+    stream.numChains = chains;
+    stream.numSubCarriers = csi.numSubCarriers;
+    stream.count = 0;
+
+    stream.groupStart.resize(this->groups + 1);
+    for (uint32_t g = 0; g <= this->groups; g++)
+    {
+        stream.groupStart[g] = g * csi.numSubCarriers / this->groups;
+    }
+
+    // Shift by the group means of the first frame
+    stream.shift.assign(cells, 0);
+    for (uint32_t c = 0; c < chains; c++)
+    {
+        const double *magnitude = &csi.magnitude[c * csi.numSubCarriers];
+        for (uint32_t g = 0; g < this->groups; g++)
+        {
+            double sum = 0;
+            for (uint32_t i = stream.groupStart[g]; i < stream.groupStart[g + 1]; i++)
+            {
+                sum += magnitude[i];
+            }
+            stream.shift[c * this->groups + g] = sum / (stream.groupStart[g + 1] - stream.groupStart[g]);
+        }
+    }
+
+    stream.blocks.assign(this->window / this->hop, Block());
+    for (Block &block : stream.blocks)
+    {
+        block.moments.resize(cells * 4);
+        block.phases.resize((chains - 1) * this->groups * 2);
+    }
+    stream.series.assign(this->fft ? cells * this->window : 0, 0);
+
+    uint32_t numFeatures = 0;
+    for (enum feature f : this->features)
+    {
+        numFeatures += f == feature::dopplerEnergy     ? chains * this->bands.size()
+                       : f == feature::phaseDifference ? (chains - 1) * this->groups * 2
+                                                       : cells;
+    }
+    stream.vector.values.resize(numFeatures);
+    stream.vector.header.magic = FEATURE_VECTOR_MAGIC;
+    memcpy(stream.vector.header.srcMac, csi.rawHeaderData.srcMac, sizeof(stream.vector.header.srcMac));
+    stream.vector.header.numChains = chains;
+    stream.vector.header.numFeatures = numFeatures;
+}
+
+void FeatureStage::update(Csi &csi)
+{
+    const uint32_t chains = csi.numRx * csi.numTx;
+    const uint32_t n = csi.numSubCarriers;
+    if (chains == 0 || n < this->groups || csi.csi.size() != chains * n || csi.magnitude.size() != chains * n)
+    {
+        return;
+    }
+
+    Stream &stream = this->streams[csi.getSourceMac()];
+    if (stream.numChains != chains || stream.numSubCarriers != n)
+    {
+        this->reset(stream, csi);
+    }
+
+    Block &block = stream.blocks[(stream.count / this->hop) % stream.blocks.size()];
+    if (stream.count % this->hop == 0)
+    {
+        std::fill(block.moments.begin(), block.moments.end(), 0);
+        std::fill(block.phases.begin(), block.phases.end(), 0);
+        block.frames = 0;
+        block.firstTimestamp = csi.rawHeaderData.timestamp;
+    }
+
+    const uint32_t slot = stream.count % this->window;
+    for (uint32_t c = 0; c < chains; c++)
+    {
+        const double *magnitude = &csi.magnitude[c * n];
+        const std::complex<double> *reference = &csi.csi[0];
+        const std::complex<double> *x = &csi.csi[c * n];
+        for (uint32_t g = 0; g < this->groups; g++)
+        {
+            const uint32_t cell = c * this->groups + g;
+            const double shift = stream.shift[cell];
+            double s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+            double sumCos = 0, sumSin = 0;
+            for (uint32_t i = stream.groupStart[g]; i < stream.groupStart[g + 1]; i++)
+            {
+                const double v = magnitude[i] - shift;
+                const double v2 = v * v;
+                s1 += v;
+                s2 += v2;
+                s3 += v2 * v;
+                s4 += v2 * v2;
+
+                if (c > 0)
+                {
+                    // Unit phasor of x * conj(reference)
+                    const double real = x[i].real() * reference[i].real() + x[i].imag() * reference[i].imag();
+                    const double imag = x[i].imag() * reference[i].real() - x[i].real() * reference[i].imag();
+                    const double norm = std::hypot(real, imag);
+                    if (norm > 0)
+                    {
+                        sumCos += real / norm;
+                        sumSin += imag / norm;
+                    }
+                }
+            }
+
+            double *moments = &block.moments[cell * 4];
+            moments[0] += s1;
+            moments[1] += s2;
+            moments[2] += s3;
+            moments[3] += s4;
+            if (c > 0)
+            {
+                block.phases[(cell - this->groups) * 2] += sumCos;
+                block.phases[(cell - this->groups) * 2 + 1] += sumSin;
+            }
+            if (!stream.series.empty())
+            {
+                stream.series[cell * this->window + slot] = shift + s1 / (stream.groupStart[g + 1] - stream.groupStart[g]);
+            }
+        }
+    }
+    block.frames++;
+    stream.count++;
+
+    if (stream.count >= this->window && stream.count % this->hop == 0)
+    {
+        this->emit(stream, csi);
+    }
+}
+
+void FeatureStage::emit(Stream &stream, const Csi &csi)
+{
+    const uint32_t chains = stream.numChains;
+    const uint32_t cells = chains * this->groups;
+
+    // Window sums from the hop blocks, the oldest block is the one overwritten next
+    std::vector<double> moments(cells * 4, 0);
+    std::vector<double> phases((chains - 1) * this->groups * 2, 0);
+    for (const Block &block : stream.blocks)
+    {
+        for (uint32_t i = 0; i < moments.size(); i++)
+        {
+            moments[i] += block.moments[i];
+        }
+        for (uint32_t i = 0; i < phases.size(); i++)
+        {
+            phases[i] += block.phases[i];
+        }
+    }
+
+    float *values = stream.vector.values.data();
+    for (enum feature f : this->features)
+    {
+        if (f == feature::dopplerEnergy)
+        {
+            for (uint32_t c = 0; c < chains; c++)
+            {
+                this->dopplerEnergies(stream, c, values);
+                values += this->bands.size();
+            }
+            continue;
+        }
+
+        if (f == feature::phaseDifference)
+        {
+            for (uint32_t cell = 0; cell < phases.size() / 2; cell++)
+            {
+                const uint32_t g = cell % this->groups;
+                const double count = (double)this->window * (stream.groupStart[g + 1] - stream.groupStart[g]);
+                const double real = phases[cell * 2] / count;
+                const double imag = phases[cell * 2 + 1] / count;
+                const double length = std::max(std::hypot(real, imag), 1e-12);
+                *values++ = std::atan2(imag, real);
+                *values++ = std::sqrt(-2 * std::log(std::min(length, 1.0)));
+            }
+            continue;
+        }
+
+        for (uint32_t cell = 0; cell < cells; cell++)
+        {
+            const uint32_t g = cell % this->groups;
+            const double count = (double)this->window * (stream.groupStart[g + 1] - stream.groupStart[g]);
+            const double m1 = moments[cell * 4] / count;
+            const double m2 = moments[cell * 4 + 1] / count;
+            const double m3 = moments[cell * 4 + 2] / count;
+            const double m4 = moments[cell * 4 + 3] / count;
+            const double variance = std::max(m2 - m1 * m1, 0.0);
+            if (f == feature::amplitudeMean)
+            {
+                *values++ = stream.shift[cell] + m1;
+            }
+            else if (f == feature::amplitudeStd)
+            {
+                *values++ = std::sqrt(variance);
+            }
+            else
+            {
+                const double central4 = m4 - 4 * m1 * m3 + 6 * m1 * m1 * m2 - 3 * m1 * m1 * m1 * m1;
+                *values++ = variance > 0 ? central4 / (variance * variance) : 0;
+            }
+        }
+    }
+
+    stream.vector.header.firstTimestamp = stream.blocks[(stream.count / this->hop) % stream.blocks.size()].firstTimestamp;
+    stream.vector.header.lastTimestamp = csi.rawHeaderData.timestamp;
+    for (FeatureSink &sink : this->sinks)
+    {
+        sink(stream.vector);
+    }
+    this->emittedVectors++;
+}
+
+// Band energies of chain averaged over its groups
+void FeatureStage::dopplerEnergies(const Stream &stream, uint32_t chain, float *energies)
+{
+    std::fill(energies, energies + this->bands.size(), 0.0f);
+    const double scale = 1.0 / ((double)this->groups * this->window);
+    const uint32_t oldest = stream.count % this->window;
+    for (uint32_t g = 0; g < this->groups; g++)
+    {
+        const double *series = &stream.series[(chain * this->groups + g) * this->window];
+        double mean = 0;
+        for (uint32_t t = 0; t < this->window; t++)
+        {
+            mean += series[t];
+        }
+        mean /= this->window;
+        for (uint32_t t = 0; t < this->window; t++)
+        {
+            this->buffer[t] = (series[(oldest + t) % this->window] - mean) * this->hann[t];
+        }
+        this->fft->forward(this->buffer.data());
+
+        for (uint32_t b = 0; b < this->bands.size(); b++)
+        {
+            for (uint32_t k = this->bands[b].first; k <= this->bands[b].second; k++)
+            {
+                const double energy = std::norm(this->buffer[k]) + (k != this->window - k ? std::norm(this->buffer[this->window - k]) : 0);
+                energies[b] += energy * scale;
+            }
+        }
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Fft.h"
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Plain complex product, std::complex operator* goes through the NaN/Inf checking library call
+static inline std::complex<double> multiply(const std::complex<double> &a, const std::complex<double> &b)
+{
+    return std::complex<double>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+const Fft &Fft::get(uint32_t size)
+{
+    static std::mutex mutex;
+    static std::map<uint32_t, std::unique_ptr<Fft>> plans;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<Fft> &plan = plans[size];
+    if (!plan)
+    {
+        plan = std::make_unique<Fft>(size);
+    }
+    return *plan;
+}
+
+Fft::Fft(uint32_t size) : size(size), log2Size(0)
+{
+    if (size < 2 || (size & (size - 1)))
+    {
+        throw std::invalid_argument("FFT size has to be a power of two: " + std::to_string(size));
+    }
+    while ((1u << this->log2Size) < size)
+    {
+        this->log2Size++;
+    }
+
+    this->bitReverse.resize(size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        uint32_t reversed = 0;
+        for (uint32_t b = 0; b < this->log2Size; b++)
+        {
+            reversed |= ((i >> b) & 1) << (this->log2Size - 1 - b);
+        }
+        this->bitReverse[i] = reversed;
+    }
+
+    this->twiddles.resize(size);
+    for (uint32_t k = 0; k < size; k++)
+    {
+        this->twiddles[k] = std::polar(1.0, -2 * M_PI * k / size);
+    }
+}
+
+uint32_t Fft::getSize() const
+{
+    return this->size;
+}
+
+void Fft::forward(std::complex<double> *data) const
+{
+    this->transform<false>(data);
+}
+
+void Fft::inverse(std::complex<double> *data) const
+{
+    this->transform<true>(data);
+    const double scale = 1.0 / this->size;
+    for (uint32_t i = 0; i < this->size; i++)
+    {
+        data[i] *= scale;
+    }
+}
+
+template <bool Inverse>
+void Fft::transform(std::complex<double> *data) const
+{
+    for (uint32_t i = 0; i < this->size; i++)
+    {
+        if (i < this->bitReverse[i])
+        {
+            std::swap(data[i], data[this->bitReverse[i]]);
+        }
+    }
+
+    uint32_t m = 1;
+    if (this->log2Size & 1)
+    {
+        for (uint32_t i = 0; i < this->size; i += 2)
+        {
+            const std::complex<double> a = data[i];
+            const std::complex<double> b = data[i + 1];
+            data[i] = a + b;
+            data[i + 1] = a - b;
+        }
+        m = 2;
+    }
+
+    // Radix-4 stages, after bit reversal a block of 4m holds DFTs of
+    // x[4n], x[4n + 2], x[4n + 1], x[4n + 3] in this order
+    for (; m < this->size; m *= 4)
+    {
+        const uint32_t blockSize = 4 * m;
+        const uint32_t stride = this->size / blockSize;
+        for (uint32_t block = 0; block < this->size; block += blockSize)
+        {
+            std::complex<double> *x = data + block;
+            for (uint32_t j = 0; j < m; j++)
+            {
+                std::complex<double> w1 = this->twiddles[j * stride];
+                std::complex<double> w2 = this->twiddles[2 * j * stride];
+                std::complex<double> w3 = this->twiddles[3 * j * stride];
+                if (Inverse)
+                {
+                    w1 = std::conj(w1);
+                    w2 = std::conj(w2);
+                    w3 = std::conj(w3);
+                }
+
+                const std::complex<double> b0 = x[j];
+                const std::complex<double> b1 = multiply(w1, x[j + 2 * m]);
+                const std::complex<double> b2 = multiply(w2, x[j + m]);
+                const std::complex<double> b3 = multiply(w3, x[j + 3 * m]);
+
+                const std::complex<double> s02 = b0 + b2;
+                const std::complex<double> d02 = b0 - b2;
+                const std::complex<double> s13 = b1 + b3;
+                // -i (b1 - b3) forward, +i (b1 - b3) inverse
+                const std::complex<double> d13 = Inverse ? std::complex<double>(-(b1 - b3).imag(), (b1 - b3).real())
+                                                         : std::complex<double>((b1 - b3).imag(), -(b1 - b3).real());
+
+                x[j] = s02 + s13;
+                x[j + m] = d02 + d13;
+                x[j + 2 * m] = s02 - s13;
+                x[j + 3 * m] = d02 - d13;
+            }
+        }
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FixedPointProcessor.h"
+#include "FixedPointKernels.h"
+#include "Logger.h"
+
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+FixedPointProcessor::FixedPointProcessor(const std::string &spec, uint32_t checkEvery) : spec(spec), checkEvery(checkEvery)
+{
+    std::istringstream specStream(spec);
+    std::string name;
+    while (std::getline(specStream, name, ','))
+    {
+        if (name == "interpolateLinear")
+        {
+            this->steps.push_back(step::interpolateLinear);
+        }
+        else if (name == "phaseCalibration")
+        {
+            this->steps.push_back(step::phaseCalibration);
+        }
+        else if (!name.empty())
+        {
+            throw std::invalid_argument("Stage not supported by the fixed point path: " + name);
+        }
+    }
+
+    if (this->checkEvery)
+    {
+        this->reference = std::make_unique<ProcessingPipeline>(spec);
+    }
+}
+
+bool FixedPointProcessor::empty() const
+{
+    return this->steps.empty();
+}
+
+void FixedPointProcessor::process(Csi &csi)
+{
+    const uint32_t chains = csi.numRx * csi.numTx;
+    const uint32_t n = csi.numSubCarriers;
+    const uint32_t size = chains * n;
+    if (this->steps.empty() || n < 2 || size * 4 != csi.rawHeaderData.csiDataSize)
+    {
+        return;
+    }
+
+    // Raw data is little endian int16 IQ, as on every CPU the NICs are used with
+    int16_t *iq = reinterpret_cast<int16_t *>(csi.getRawCsiData());
+
+    std::unique_ptr<Csi> expected;
+    if (this->checkEvery && this->processedFrames % this->checkEvery == 0)
+    {
+        expected = std::make_unique<Csi>();
+        expected->loadFromMemory(reinterpret_cast<uint8_t *>(&csi.rawHeaderData), csi.getRawCsiData());
+        this->reference->process(*expected);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const SubcarrierLayout *layout = csi.layout && csi.layout->numSubCarriers == n ? csi.layout : nullptr;
+    this->magnitude.resize(size);
+    this->phase.resize(size);
+    fixedPoint::toPolar(iq, size, this->magnitude.data(), this->phase.data());
+
+    for (enum step s : this->steps)
+    {
+        if (s == step::interpolateLinear && layout)
+        {
+            for (uint32_t c = 0; c < chains; c++)
+            {
+                fixedPoint::interpolatePilotsLinear(&this->magnitude[c * n], &this->phase[c * n], layout->pilots, layout->numPilots);
+            }
+        }
+        else if (s == step::phaseCalibration)
+        {
+            const Fit &fit = this->getFit(layout, n);
+            for (uint32_t c = 0; c < chains; c++)
+            {
+                fixedPoint::sanitizeLinearPhase(&this->phase[c * n], n, fit.weights.data(), fit.kOffsets.data());
+            }
+        }
+    }
+
+    fixedPoint::fromPolar(this->magnitude.data(), this->phase.data(), size, iq);
+    auto end = std::chrono::steady_clock::now();
+    this->processedFrames++;
+    this->processingTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    if (expected)
+    {
+        this->check(csi, *expected);
+    }
+}
+
+// Weights of the phase fit are derived once per layout, the fixed point path only uses them
+const FixedPointProcessor::Fit &FixedPointProcessor::getFit(const SubcarrierLayout *layout, uint32_t n)
+{
+    auto key = std::make_pair(layout, layout ? 0 : n);
+    auto it = this->fits.find(key);
+    if (it != this->fits.end())
+    {
+        return it->second;
+    }
+
+    // Unknown layout, symmetric numbering around DC as PhaseSanitizer does
+    std::vector<double> k(n);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        k[i] = layout ? layout->k[i] : (int)i - (int)(n / 2);
+    }
+    double kMean = 0;
+    for (double v : k)
+    {
+        kMean += v;
+    }
+    kMean /= n;
+    double sumSquares = 0;
+    for (double v : k)
+    {
+        sumSquares += (v - kMean) * (v - kMean);
+    }
+
+    Fit &fit = this->fits[key];
+    for (double v : k)
+    {
+        fit.weights.push_back(std::llround(std::ldexp((v - kMean) / sumSquares, 40)));
+        fit.kOffsets.push_back(std::lround(2 * (v - kMean)));
+    }
+    return fit;
+}
+
+void FixedPointProcessor::check(const Csi &csi, const Csi &expected)
+{
+    const int16_t *iq = reinterpret_cast<const int16_t *>(csi.getRawCsiData());
+    if (expected.csi.size() * 4 != csi.rawHeaderData.csiDataSize)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < expected.csi.size(); i++)
+    {
+        const double error = std::abs(std::complex<double>(iq[2 * i], iq[2 * i + 1]) - expected.csi[i]);
+        this->maxError = std::max(this->maxError, error);
+        this->sumSquaredError += error * error;
+        this->sumSquaredSignal += std::norm(expected.csi[i]);
+    }
+    this->checkedFrames++;
+}
+
+void FixedPointProcessor::printStatistics()
+{
+    double ms = this->processingTimeNs / 1e6;
+    double fps = this->processingTimeNs ? this->processedFrames * 1e9 / this->processingTimeNs : 0;
+    Logger::log(info) << "Fixed point " << this->spec << ": " << this->processedFrames << " frames, " << ms << " ms, " << fps << " frames/s\n";
+    if (this->checkedFrames)
+    {
+        double snr = this->sumSquaredError > 0 ? 10 * std::log10(this->sumSquaredSignal / this->sumSquaredError) : INFINITY;
+        Logger::log(info) << "Fixed point accuracy over " << this->checkedFrames << " frames: SNR " << snr << " dB, max error " << this->maxError << "\n";
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HampelStage.h"
+
+#include <cmath>
+#include <stdexcept>
+
+HampelStage::HampelStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            this->window = std::stoul(value);
+        }
+        else if (key == "threshold")
+        {
+            this->threshold = std::stod(value);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of hampel: " + key);
+        }
+    }
+
+    if (this->window < 3)
+    {
+        throw std::invalid_argument("Hampel window has to be at least 3");
+    }
+}
+
+const char *HampelStage::name() const
+{
+    return "hampel";
+}
+
+bool HampelStage::isSequential() const
+{
+    return true;
+}
+
+void HampelStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->filter(*csi);
+    }
+}
+
+void HampelStage::filter(Csi &csi)
+{
+    Stream &stream = this->streams[csi.getSourceMac()];
+    const uint32_t size = csi.magnitude.size();
+    if (stream.numValues != size)
+    {
+        stream.numValues = size;
+        stream.values.assign(size, SlidingMedian(this->window));
+        stream.deviations.assign(size, SlidingMedian(this->window));
+    }
+
+    // Gaussian consistency constant of MAD
+    const double scale = this->threshold * 1.4826;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        const double value = csi.magnitude[i];
+        stream.values[i].push(value);
+        const double median = stream.values[i].median();
+        const double deviation = std::abs(value - median);
+        stream.deviations[i].push(deviation);
+
+        if (stream.values[i].size() == this->window && deviation > scale * stream.deviations[i].median())
+        {
+            csi.magnitude[i] = median;
+            csi.csi[i] = std::polar(median, csi.phase[i]);
+            this->replacedValues++;
+        }
+    }
+}
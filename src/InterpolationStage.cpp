@@ -0,0 +1,76 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InterpolationStage.h"
+#include "interpolation.h"
+#include "ShapeKernels.h"
+
+InterpolationStage::InterpolationStage(enum processor type) : type(type)
+{
+}
+
+const char *InterpolationStage::name() const
+{
+    switch (this->type)
+    {
+    case processor::interpolateCubic:
+        return "interpolateCubic";
+    case processor::interpolateCosine:
+        return "interpolateCosine";
+    default:
+        return "interpolateLinear";
+    }
+}
+
+void InterpolationStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->interpolate(*csi);
+    }
+}
+
+void InterpolationStage::interpolate(Csi &csi)
+{
+    if (!csi.layout)
+    {
+        return;
+    }
+
+    shapeKernels::dispatch(csi.numRx * csi.numTx, csi.numSubCarriers, [&](auto shape)
+                           {
+        const uint32_t *pilots = csi.layout->pilots;
+        const uint32_t numPilots = csi.layout->numPilots;
+        if (this->type == processor::interpolateLinear)
+        {
+            shapeKernels::interpolatePilots(shape, csi.magnitude.data(), csi.phase.data(), pilots, numPilots, [](const double *v, uint32_t i)
+                                            { return interpolation::linearInterpolate(v[i - 1], v[i + 1], 0.5); });
+        }
+        else if (this->type == processor::interpolateCubic)
+        {
+            shapeKernels::interpolatePilots(shape, csi.magnitude.data(), csi.phase.data(), pilots, numPilots, [](const double *v, uint32_t i)
+                                            { return interpolation::cubicInterpolate(v[i - 2], v[i - 1], v[i + 1], v[i + 2], 0.5); });
+        }
+        else if (this->type == processor::interpolateCosine)
+        {
+            shapeKernels::interpolatePilots(shape, csi.magnitude.data(), csi.phase.data(), pilots, numPilots, [](const double *v, uint32_t i)
+                                            { return interpolation::cosineInterpolate(v[i - 1], v[i + 1], 0.5); });
+        } });
+
+    csi.magnitudePhaseToComplex();
+}
@@ -22,6 +22,8 @@
 #include "gui/MainWindow.h"
 #include "layout.h"
 #include "WiFiFtmController.h"
+#include "BatchProcessor.h"
+#include "ProcessedCache.h"
 #include <iostream>
 #include <chrono>
 #include <thread>
@@ -269,6 +271,29 @@ void MainController::runUdpSocket()
     udpSocket->init();
 }
 
+int MainController::runProcess()
+{
+    try
+    {
+        std::vector<std::string> inputs = BatchProcessor::expandInputs(Arguments::arguments.inputFiles);
+        std::unique_ptr<ProcessedCache> cache;
+        if (!Arguments::arguments.noCache)
+        {
+            cache = std::make_unique<ProcessedCache>(Arguments::arguments.cacheDir, Arguments::arguments.cacheSize * 1024 * 1024);
+        }
+
+        BatchProcessor processor(Arguments::arguments.pipeline, Arguments::arguments.threads);
+        uint32_t failed = processor.run(inputs, Arguments::arguments.outputFile, cache.get());
+        processor.printStatistics();
+        return failed ? 1 : 0;
+    }
+    catch (const std::exception &e)
+    {
+        Logger::log(error) << e.what() << '\n';
+        return 1;
+    }
+}
+
 void MainController::initInterface()
 {
     try
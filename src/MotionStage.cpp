@@ -0,0 +1,200 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MotionStage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+MotionStage::MotionStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            this->window = std::stoul(value);
+        }
+        else if (key == "on")
+        {
+            this->on = std::stod(value);
+        }
+        else if (key == "off")
+        {
+            this->off = std::stod(value);
+        }
+        else if (key == "hold")
+        {
+            this->hold = std::stoul(value);
+        }
+        else if (key == "every")
+        {
+            this->every = std::stoul(value);
+        }
+        else if (key == "output")
+        {
+            this->output = RecordFile(value);
+            this->addSink([this](const MotionEvent &event)
+                          { this->output.write(&event, sizeof(MotionEvent)); });
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of motion: " + key);
+        }
+    }
+
+    if (this->window < 2)
+    {
+        throw std::invalid_argument("Motion window has to be at least 2");
+    }
+    if (this->off > this->on)
+    {
+        throw std::invalid_argument("Motion off threshold has to be lower than on");
+    }
+}
+
+const char *MotionStage::name() const
+{
+    return "motion";
+}
+
+bool MotionStage::isSequential() const
+{
+    return true;
+}
+
+bool MotionStage::hasOutput() const
+{
+    return this->output.isSet();
+}
+
+void MotionStage::addSink(const MotionSink &sink)
+{
+    this->sinks.push_back(sink);
+}
+
+void MotionStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->update(*csi);
+    }
+}
+
+void MotionStage::update(Csi &csi)
+{
+    const uint32_t size = csi.magnitude.size();
+    double sum = 0;
+    for (double m : csi.magnitude)
+    {
+        sum += m;
+    }
+    if (size < 2 || sum <= 0)
+    {
+        return;
+    }
+
+    Stream &stream = this->streams[csi.getSourceMac()];
+    if (stream.numValues != size)
+    {
+        stream.numValues = size;
+        stream.count = 0;
+        stream.moments.assign(size, SlidingMoments(this->window));
+        stream.previous.assign(size, 0);
+        stream.correlation = SlidingMoments(this->window);
+        stream.quietFrames = 0;
+    }
+
+    const double scale = size / sum;
+    this->normalized.resize(size);
+    double variance = 0;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        this->normalized[i] = csi.magnitude[i] * scale;
+        stream.moments[i].push(this->normalized[i]);
+        variance += stream.moments[i].variance();
+    }
+    variance /= size;
+
+    // Pearson correlation with the previous frame, both vectors have mean 1 after normalization
+    if (stream.count)
+    {
+        double cross = 0;
+        double current = 0;
+        double previous = 0;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            const double a = this->normalized[i] - 1;
+            const double b = stream.previous[i] - 1;
+            cross += a * b;
+            current += a * a;
+            previous += b * b;
+        }
+        stream.correlation.push(current > 0 && previous > 0 ? cross / std::sqrt(current * previous) : 1);
+    }
+    stream.previous.swap(this->normalized);
+    stream.count++;
+
+    // Features need a full window before decisions
+    if (stream.count < this->window)
+    {
+        return;
+    }
+
+    const double level = std::max(std::sqrt(variance), 1 - stream.correlation.mean());
+    if (!stream.present && level >= this->on)
+    {
+        stream.present = true;
+        stream.quietFrames = 0;
+        this->emit(csi, presenceOn, stream, level, variance);
+    }
+    else if (stream.present)
+    {
+        stream.quietFrames = level < this->off ? stream.quietFrames + 1 : 0;
+        if (stream.quietFrames >= this->hold)
+        {
+            stream.present = false;
+            this->emit(csi, presenceOff, stream, level, variance);
+        }
+    }
+
+    if (this->every && stream.count % this->every == 0)
+    {
+        this->emit(csi, motionLevel, stream, level, variance);
+    }
+}
+
+void MotionStage::emit(const Csi &csi, enum motionEvent type, const Stream &stream, double level, double variance)
+{
+    MotionEvent event;
+    event.magic = MOTION_EVENT_MAGIC;
+    event.timestamp = csi.rawHeaderData.timestamp;
+    memcpy(event.srcMac, csi.rawHeaderData.srcMac, sizeof(event.srcMac));
+    event.type = type;
+    event.present = stream.present;
+    event.level = level;
+    event.variance = variance;
+    event.correlation = stream.correlation.mean();
+
+    for (MotionSink &sink : this->sinks)
+    {
+        sink(event);
+    }
+    this->emittedEvents++;
+}
@@ -0,0 +1,429 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MusicStage.h"
+#include "MatrixKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+// Local refinement halves the grid step this many times around every coarse peak
+#define MUSIC_REFINE_STEPS 8
+#define MUSIC_MAX_AUTO_PATHS 5
+
+MusicStage::MusicStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "subcarriers")
+        {
+            this->numSubCarriers = std::stoul(value);
+        }
+        else if (key == "length")
+        {
+            this->length = std::stoul(value);
+        }
+        else if (key == "paths")
+        {
+            this->paths = std::stoul(value);
+        }
+        else if (key == "spacing")
+        {
+            this->spacing = std::stod(value);
+        }
+        else if (key == "aoaStep")
+        {
+            this->aoaStep = std::stod(value);
+        }
+        else if (key == "tofPoints")
+        {
+            this->tofPoints = std::stoul(value);
+        }
+        else if (key == "threads")
+        {
+            this->threads = std::stoul(value);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of music: " + key);
+        }
+    }
+
+    if (this->length < 2 || this->numSubCarriers <= this->length)
+    {
+        throw std::invalid_argument("MUSIC needs 2 <= length < subcarriers");
+    }
+    if (this->aoaStep <= 0 || this->tofPoints < 2 || this->threads == 0)
+    {
+        throw std::invalid_argument("MUSIC needs aoaStep > 0, tofPoints >= 2 and threads >= 1");
+    }
+    this->workspaces.resize(this->threads);
+}
+
+const char *MusicStage::name() const
+{
+    return "music";
+}
+
+void MusicStage::process(std::vector<Csi *> &batch)
+{
+    // Plans are built before the threads start, they only read them
+    std::vector<const Plan *> framePlans(batch.size());
+    for (uint32_t i = 0; i < batch.size(); i++)
+    {
+        framePlans[i] = this->getPlan(*batch[i]);
+    }
+
+    auto worker = [&](uint32_t t, uint32_t step)
+    {
+        for (uint32_t i = t; i < batch.size(); i += step)
+        {
+            batch[i]->paths.clear();
+            if (framePlans[i])
+            {
+                this->estimate(*batch[i], *framePlans[i], this->workspaces[t]);
+            }
+        }
+    };
+
+    const uint32_t threadCount = std::min<uint32_t>(this->threads, batch.size());
+    if (threadCount <= 1)
+    {
+        worker(0, 1);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    for (uint32_t t = 0; t < threadCount; t++)
+    {
+        pool.emplace_back(worker, t, threadCount);
+    }
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+}
+
+const MusicStage::Plan *MusicStage::getPlan(const Csi &csi)
+{
+    if (!csi.layout || csi.numRx == 0 || csi.numTx == 0)
+    {
+        return nullptr;
+    }
+
+    const auto key = std::make_pair(csi.layout, csi.numRx);
+    auto it = this->plans.find(key);
+    if (it != this->plans.end())
+    {
+        return it->second.positions.empty() ? nullptr : &it->second;
+    }
+
+    Plan &plan = this->plans[key];
+    const SubcarrierLayout &layout = *csi.layout;
+
+    // Smoothing needs a constant tone spacing, look for the widest uniform grid of k present in the layout
+    std::map<int, uint32_t> positions;
+    for (uint32_t i = 0; i < layout.numSubCarriers; i++)
+    {
+        positions[layout.k[i]] = i;
+    }
+    const int first = layout.k[0];
+    const int last = layout.k[layout.numSubCarriers - 1];
+    uint32_t toneStep = 0;
+    for (uint32_t count = std::min(this->numSubCarriers, layout.numSubCarriers); count > this->length && plan.positions.empty(); count--)
+    {
+        for (uint32_t step = (last - first) / (count - 1); step > 0 && plan.positions.empty(); step--)
+        {
+            for (int start = first; start + (int)(step * (count - 1)) <= last; start++)
+            {
+                uint32_t found = 0;
+                while (found < count && positions.count(start + found * step))
+                {
+                    found++;
+                }
+                if (found == count)
+                {
+                    for (uint32_t j = 0; j < count; j++)
+                    {
+                        plan.positions.push_back(positions[start + j * step]);
+                    }
+                    toneStep = step;
+                    break;
+                }
+            }
+        }
+    }
+    if (plan.positions.empty())
+    {
+        return nullptr;
+    }
+
+    const double bandwidth = (20 << ((layout.channelWidth & RATE_MCS_CHAN_WIDTH_MSK) >> RATE_MCS_CHAN_WIDTH_POS)) * 1e6;
+    plan.toneSpacing = toneStep * bandwidth / layout.fftSize;
+    plan.antennas = csi.numRx > 2 ? csi.numRx - 1 : csi.numRx;
+    plan.antennaShifts = csi.numRx - plan.antennas + 1;
+
+    if (plan.antennas == 1)
+    {
+        plan.aoaGrid.push_back(0);
+    }
+    else
+    {
+        for (double aoa = -90; aoa <= 90; aoa += this->aoaStep)
+        {
+            plan.aoaGrid.push_back(aoa);
+        }
+    }
+    for (uint32_t t = 0; t < this->tofPoints; t++)
+    {
+        plan.tofGrid.push_back(t / (plan.toneSpacing * this->tofPoints));
+    }
+
+    for (double aoa : plan.aoaGrid)
+    {
+        for (uint32_t i = 0; i < plan.antennas; i++)
+        {
+            plan.aoaSteering.push_back(std::polar(1.0, -2 * M_PI * this->spacing * i * std::sin(aoa * M_PI / 180)));
+        }
+    }
+    for (double tof : plan.tofGrid)
+    {
+        for (uint32_t j = 0; j < this->length; j++)
+        {
+            plan.tofSteering.push_back(std::polar(1.0, -2 * M_PI * plan.toneSpacing * j * tof));
+        }
+    }
+    return &plan;
+}
+
+void MusicStage::estimate(Csi &csi, const Plan &plan, Workspace &workspace) const
+{
+    const uint32_t subcarrierShifts = plan.positions.size() - this->length + 1;
+    const uint32_t dimension = plan.antennas * this->length;
+    const uint32_t columns = plan.antennaShifts * subcarrierShifts;
+
+    // Smoothed covariance, every antenna and subcarrier subarray is one column
+    workspace.covariance.assign(dimension * dimension, 0);
+    workspace.aoaVector.resize(dimension);
+    for (uint32_t a = 0; a < plan.antennaShifts; a++)
+    {
+        for (uint32_t s = 0; s < subcarrierShifts; s++)
+        {
+            std::complex<double> *x = workspace.aoaVector.data();
+            for (uint32_t i = 0; i < plan.antennas; i++)
+            {
+                const std::complex<double> *chain = &csi.csi[(a + i) * csi.numTx * csi.numSubCarriers];
+                for (uint32_t j = 0; j < this->length; j++)
+                {
+                    x[i * this->length + j] = chain[plan.positions[s + j]];
+                }
+            }
+            for (uint32_t r = 0; r < dimension; r++)
+            {
+                for (uint32_t c = r; c < dimension; c++)
+                {
+                    workspace.covariance[r * dimension + c] += matrixKernels::multiplyConj(x[r], x[c]);
+                }
+            }
+        }
+    }
+    // Only the upper triangle was accumulated
+    for (uint32_t r = 0; r < dimension; r++)
+    {
+        for (uint32_t c = r; c < dimension; c++)
+        {
+            workspace.covariance[r * dimension + c] /= (double)columns;
+            workspace.covariance[c * dimension + r] = std::conj(workspace.covariance[r * dimension + c]);
+        }
+    }
+
+    workspace.vectors.resize(dimension * dimension);
+    workspace.eigenvalues.resize(dimension);
+    matrixKernels::hermitianEigen(workspace.covariance.data(), dimension, workspace.eigenvalues.data(), workspace.vectors.data());
+
+    uint32_t numPaths = std::min(this->paths, dimension - 1);
+    if (numPaths == 0)
+    {
+        // Largest drop between consecutive eigenvalues separates signal from noise
+        const double floor = std::max(workspace.eigenvalues[0] * 1e-12, 1e-300);
+        double bestRatio = 0;
+        for (uint32_t p = 1; p <= std::min<uint32_t>(MUSIC_MAX_AUTO_PATHS, dimension - 1); p++)
+        {
+            const double ratio = workspace.eigenvalues[p - 1] / std::max(workspace.eigenvalues[p], floor);
+            if (ratio > bestRatio)
+            {
+                bestRatio = ratio;
+                numPaths = p;
+            }
+        }
+    }
+    if (numPaths == 0)
+    {
+        return;
+    }
+
+    workspace.signal.resize(numPaths * dimension);
+    for (uint32_t p = 0; p < numPaths; p++)
+    {
+        for (uint32_t d = 0; d < dimension; d++)
+        {
+            workspace.signal[p * dimension + d] = std::conj(workspace.vectors[d * dimension + p]);
+        }
+    }
+
+    // Coarse search, the AoA part of the steering vector is applied once per angle
+    const uint32_t numAoa = plan.aoaGrid.size();
+    const uint32_t numTof = plan.tofGrid.size();
+    workspace.spectrum.resize(numAoa * numTof);
+    workspace.partial.resize(numPaths * this->length);
+    for (uint32_t g = 0; g < numAoa; g++)
+    {
+        const std::complex<double> *aoaSteering = &plan.aoaSteering[g * plan.antennas];
+        for (uint32_t p = 0; p < numPaths; p++)
+        {
+            for (uint32_t j = 0; j < this->length; j++)
+            {
+                std::complex<double> sum = 0;
+                for (uint32_t i = 0; i < plan.antennas; i++)
+                {
+                    sum += matrixKernels::multiply(workspace.signal[p * dimension + i * this->length + j], aoaSteering[i]);
+                }
+                workspace.partial[p * this->length + j] = sum;
+            }
+        }
+
+        for (uint32_t t = 0; t < numTof; t++)
+        {
+            const std::complex<double> *tofSteering = &plan.tofSteering[t * this->length];
+            double projection = 0;
+            for (uint32_t p = 0; p < numPaths; p++)
+            {
+                std::complex<double> sum = 0;
+                for (uint32_t j = 0; j < this->length; j++)
+                {
+                    sum += matrixKernels::multiply(workspace.partial[p * this->length + j], tofSteering[j]);
+                }
+                projection += std::norm(sum);
+            }
+            // |noise^H a|^2 = |a|^2 - |signal^H a|^2
+            workspace.spectrum[g * numTof + t] = 1 / std::max(dimension - projection, 1e-12 * dimension);
+        }
+    }
+
+    std::vector<std::pair<double, uint32_t>> peaks;
+    for (uint32_t g = 0; g < numAoa; g++)
+    {
+        for (uint32_t t = 0; t < numTof; t++)
+        {
+            const double value = workspace.spectrum[g * numTof + t];
+            bool peak = true;
+            for (int dg = -1; dg <= 1 && peak; dg++)
+            {
+                for (int dt = -1; dt <= 1 && peak; dt++)
+                {
+                    const int ng = g + dg;
+                    const int nt = t + dt;
+                    if ((dg || dt) && ng >= 0 && ng < (int)numAoa && nt >= 0 && nt < (int)numTof)
+                    {
+                        peak = workspace.spectrum[ng * numTof + nt] <= value;
+                    }
+                }
+            }
+            if (peak)
+            {
+                peaks.emplace_back(value, g * numTof + t);
+            }
+        }
+    }
+    std::sort(peaks.begin(), peaks.end(), [](const auto &x, const auto &y)
+              { return x.first > y.first; });
+    peaks.resize(std::min<size_t>(peaks.size(), numPaths));
+
+    const double tofStep = plan.tofGrid[1] - plan.tofGrid[0];
+    for (const auto &[value, index] : peaks)
+    {
+        double aoa = plan.aoaGrid[index / numTof];
+        double tof = plan.tofGrid[index % numTof];
+        double best = value;
+        double aoaDelta = plan.antennas > 1 ? this->aoaStep : 0;
+        double tofDelta = tofStep;
+        for (uint32_t r = 0; r < MUSIC_REFINE_STEPS; r++)
+        {
+            aoaDelta /= 2;
+            tofDelta /= 2;
+            double bestAoa = aoa;
+            double bestTof = tof;
+            for (int da = -1; da <= 1; da++)
+            {
+                for (int dt = -1; dt <= 1; dt++)
+                {
+                    if (!da && !dt)
+                    {
+                        continue;
+                    }
+                    const double candidateAoa = std::clamp(aoa + da * aoaDelta, -90.0, 90.0);
+                    const double candidateTof = tof + dt * tofDelta;
+                    const double candidate = this->evaluate(plan, workspace, numPaths, candidateAoa, candidateTof);
+                    if (candidate > best)
+                    {
+                        best = candidate;
+                        bestAoa = candidateAoa;
+                        bestTof = candidateTof;
+                    }
+                }
+            }
+            aoa = bestAoa;
+            tof = bestTof;
+        }
+        csi.paths.push_back({(float)aoa, (float)(tof * 1e9), (float)best});
+    }
+}
+
+double MusicStage::evaluate(const Plan &plan, Workspace &workspace, uint32_t numPaths, double aoa, double tof) const
+{
+    const uint32_t dimension = plan.antennas * this->length;
+    workspace.aoaVector.resize(plan.antennas);
+    workspace.tofVector.resize(this->length);
+    for (uint32_t i = 0; i < plan.antennas; i++)
+    {
+        workspace.aoaVector[i] = std::polar(1.0, -2 * M_PI * this->spacing * i * std::sin(aoa * M_PI / 180));
+    }
+    for (uint32_t j = 0; j < this->length; j++)
+    {
+        workspace.tofVector[j] = std::polar(1.0, -2 * M_PI * plan.toneSpacing * j * tof);
+    }
+
+    double projection = 0;
+    for (uint32_t p = 0; p < numPaths; p++)
+    {
+        std::complex<double> sum = 0;
+        for (uint32_t i = 0; i < plan.antennas; i++)
+        {
+            std::complex<double> row = 0;
+            for (uint32_t j = 0; j < this->length; j++)
+            {
+                row += matrixKernels::multiply(workspace.signal[p * dimension + i * this->length + j], workspace.tofVector[j]);
+            }
+            sum += matrixKernels::multiply(row, workspace.aoaVector[i]);
+        }
+        projection += std::norm(sum);
+    }
+    return 1 / std::max(dimension - projection, 1e-12 * dimension);
+}
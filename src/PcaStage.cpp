@@ -0,0 +1,194 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PcaStage.h"
+#include "MatrixKernels.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+// Iterations of the first basis of a transmitter, later updates are warm started
+#define PCA_INITIAL_ITERATIONS 30
+
+PcaStage::PcaStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            this->window = std::stoul(value);
+        }
+        else if (key == "components")
+        {
+            this->components = std::stoul(value);
+        }
+        else if (key == "hop")
+        {
+            this->hop = std::stoul(value);
+        }
+        else if (key == "iterations")
+        {
+            this->iterations = std::stoul(value);
+        }
+        else if (key == "output")
+        {
+            this->output = RecordFile(value);
+            this->addSink([this](const PcaFrame &frame)
+                          { this->output.write(&frame.header, sizeof(PcaHeader), frame.components.data(), frame.components.size() * sizeof(float)); });
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of pca: " + key);
+        }
+    }
+
+    if (this->window < 2 || this->components == 0 || this->components > this->window || this->hop == 0 || this->iterations == 0)
+    {
+        throw std::invalid_argument("PCA needs window >= 2, 1 <= components <= window, hop >= 1 and iterations >= 1");
+    }
+}
+
+const char *PcaStage::name() const
+{
+    return "pca";
+}
+
+bool PcaStage::isSequential() const
+{
+    return true;
+}
+
+bool PcaStage::hasOutput() const
+{
+    return this->output.isSet();
+}
+
+void PcaStage::addSink(const PcaSink &sink)
+{
+    this->sinks.push_back(sink);
+}
+
+void PcaStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->update(*csi);
+    }
+}
+
+void PcaStage::update(Csi &csi)
+{
+    Stream &stream = this->streams[csi.getSourceMac()];
+    const uint32_t size = csi.magnitude.size();
+    const uint32_t k = this->components;
+    if (stream.numValues != size)
+    {
+        stream = Stream();
+        stream.numValues = size;
+        stream.rows.resize((uint64_t)this->window * size);
+        stream.sum.resize(size);
+        stream.mean.resize(size);
+        stream.basis.resize(size * k);
+        stream.projected.resize(this->window * k);
+        memcpy(stream.frame.header.srcMac, csi.rawHeaderData.srcMac, sizeof(stream.frame.header.srcMac));
+        stream.frame.header.numComponents = k;
+        stream.frame.components.resize(k);
+    }
+
+    const uint32_t slot = stream.count % this->window;
+    double *row = &stream.rows[(uint64_t)slot * size];
+    const bool full = stream.count >= this->window;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        stream.sum[i] += csi.magnitude[i] - (full ? row[i] : 0);
+        row[i] = csi.magnitude[i];
+    }
+    stream.count++;
+
+    // Removals accumulate rounding error, recompute the sums once per window
+    if (stream.count % this->window == 0)
+    {
+        std::fill(stream.sum.begin(), stream.sum.end(), 0.0);
+        for (uint32_t r = 0; r < this->window; r++)
+        {
+            const double *windowRow = &stream.rows[(uint64_t)r * size];
+            for (uint32_t i = 0; i < size; i++)
+            {
+                stream.sum[i] += windowRow[i];
+            }
+        }
+    }
+
+    if (stream.count < this->window)
+    {
+        return;
+    }
+    if (!stream.hasBasis)
+    {
+        this->updateBasis(stream, PCA_INITIAL_ITERATIONS);
+        stream.hasBasis = true;
+    }
+    else if ((stream.count - this->window) % this->hop == 0)
+    {
+        this->updateBasis(stream, this->iterations);
+    }
+
+    matrixKernels::multiplyCentered(row, stream.mean.data(), 1, size, stream.basis.data(), k, stream.projected.data());
+    stream.frame.header.timestamp = csi.rawHeaderData.timestamp;
+    for (uint32_t j = 0; j < k; j++)
+    {
+        stream.frame.components[j] = stream.projected[j];
+    }
+    for (PcaSink &sink : this->sinks)
+    {
+        sink(stream.frame);
+    }
+}
+
+void PcaStage::updateBasis(Stream &stream, uint32_t iterations)
+{
+    const uint32_t size = stream.numValues;
+    const uint32_t k = this->components;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        stream.mean[i] = stream.sum[i] / this->window;
+    }
+
+    if (!stream.hasBasis)
+    {
+        // Deterministic start with components spread over all values
+        for (uint32_t i = 0; i < size; i++)
+        {
+            for (uint32_t j = 0; j < k; j++)
+            {
+                stream.basis[i * k + j] = std::cos((i + 1) * (j + 1) * 0.7) + (i % k == j ? 1 : 0);
+            }
+        }
+        matrixKernels::orthonormalizeColumns(stream.basis.data(), size, k);
+    }
+
+    for (uint32_t it = 0; it < iterations; it++)
+    {
+        // Rows of the projection of centered data sum to zero, so multiplying by the
+        // uncentered window transposed gives the same result as by the centered one
+        matrixKernels::multiplyCentered(stream.rows.data(), stream.mean.data(), this->window, size, stream.basis.data(), k, stream.projected.data());
+        matrixKernels::multiplyTransposed(stream.rows.data(), this->window, size, stream.projected.data(), k, stream.basis.data());
+        matrixKernels::orthonormalizeColumns(stream.basis.data(), size, k);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PhaseSanitizer.h"
+#include "ShapeKernels.h"
+
+
+const char *PhaseSanitizer::name() const
+{
+    return "phaseCalibration";
+}
+
+void PhaseSanitizer::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->process(*csi);
+    }
+}
+
+void PhaseSanitizer::process(Csi &csi)
+{
+    if (csi.numSubCarriers < 2)
+    {
+        return;
+    }
+
+    const SubcarrierLayout &layout = this->getLayout(csi);
+    if (this->corrections.size() < csi.numSubCarriers)
+    {
+        this->corrections.resize(csi.numSubCarriers);
+    }
+
+    shapeKernels::dispatch(csi.numRx * csi.numTx, csi.numSubCarriers, [&](auto shape)
+                           { shapeKernels::sanitizeLinearPhase(shape, csi.phase.data(), this->corrections.data(), layout); });
+    csi.magnitudePhaseToComplex();
+}
+
+const SubcarrierLayout &PhaseSanitizer::getLayout(const Csi &csi)
+{
+    if (csi.layout)
+    {
+        return *csi.layout;
+    }
+
+    // Unknown layout, fall back to symmetric numbering around DC
+    auto it = this->fallbackLayouts.find(csi.numSubCarriers);
+    if (it == this->fallbackLayouts.end())
+    {
+        FallbackLayout &fallback = this->fallbackLayouts[csi.numSubCarriers];
+        const int half = csi.numSubCarriers / 2;
+        double kMean = 0;
+        for (uint32_t i = 0; i < csi.numSubCarriers; i++)
+        {
+            fallback.k.push_back((int)i - half);
+            kMean += fallback.k.back();
+        }
+        kMean /= csi.numSubCarriers;
+
+        double sumSquares = 0;
+        for (int16_t k : fallback.k)
+        {
+            sumSquares += (k - kMean) * (k - kMean);
+        }
+
+        fallback.layout = {csi.format, csi.channelWidth, 0, csi.numSubCarriers, fallback.k.data(), nullptr, 0, nullptr, 0, 0, 0, kMean, 1 / sumSquares};
+        return fallback.layout;
+    }
+    return it->second.layout;
+}
@@ -0,0 +1,211 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcessedCache.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <ios>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    uint64_t hashBytes(const void *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+        return hash;
+    }
+}
+
+ProcessedCache::ProcessedCache(const std::string &directory, uint64_t maxBytes) : directory(directory), maxBytes(maxBytes)
+{
+    if (this->directory.empty())
+    {
+        const char *xdg = std::getenv("XDG_CACHE_HOME");
+        const char *home = std::getenv("HOME");
+        this->directory = xdg && *xdg ? std::string(xdg) + "/FeitCSI" : std::string(home ? home : "/tmp") + "/.cache/FeitCSI";
+    }
+    std::filesystem::create_directories(this->directory);
+}
+
+std::string ProcessedCache::makeKey(const std::string &inputFile, const CsiFrameStore &store, const std::string &pipelineSpec)
+{
+    struct stat status;
+    if (stat(inputFile.c_str(), &status) == -1)
+    {
+        throw std::ios_base::failure("Stat file failed: " + std::string(std::strerror(errno)));
+    }
+
+    // Frame offsets and the first and last header, cheap to get and catches rewrites keeping size and time
+    uint64_t indexHash = hashBytes(nullptr, 0);
+    if (store.size())
+    {
+        const uint8_t *first = store.getRawFrame(0);
+        for (size_t i = 0; i < store.size(); i++)
+        {
+            const uint64_t offset = store.getRawFrame(i) - first;
+            indexHash = hashBytes(&offset, sizeof(offset), indexHash);
+        }
+        indexHash = hashBytes(first, CSI_HEADER_LENGTH, indexHash);
+        indexHash = hashBytes(store.getRawFrame(store.size() - 1), CSI_HEADER_LENGTH, indexHash);
+    }
+
+    std::ostringstream key;
+    key << "FeitCSI " << FEITCSI_VERSION << ' ' << PROCESSED_CACHE_FORMAT << '\n'
+        << status.st_size << ' ' << status.st_mtim.tv_sec << '.' << status.st_mtim.tv_nsec << ' ' << std::hex << indexHash << std::dec << '\n'
+        << pipelineSpec;
+    return key.str();
+}
+
+std::string ProcessedCache::entryPath(const std::string &key) const
+{
+    std::ostringstream path;
+    path << this->directory << '/' << std::hex << hashBytes(key.data(), key.size()) << ".bin";
+    return path.str();
+}
+
+bool ProcessedCache::serve(const std::string &key, std::ostream &out, uint64_t &bytes)
+{
+    const std::string path = this->entryPath(key);
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) == -1 || (size_t)status.st_size < sizeof(ProcessedCacheHeader) + key.size())
+    {
+        ::close(fd);
+        return false;
+    }
+    void *memory = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+    madvise(memory, status.st_size, MADV_SEQUENTIAL);
+
+    const uint8_t *data = static_cast<const uint8_t *>(memory);
+    ProcessedCacheHeader header;
+    memcpy(&header, data, sizeof(header));
+    const bool valid = header.magic == PROCESSED_CACHE_MAGIC && header.keyLength == key.size() &&
+                       sizeof(header) + header.keyLength + header.dataSize == (uint64_t)status.st_size &&
+                       memcmp(data + sizeof(header), key.data(), key.size()) == 0;
+    if (valid)
+    {
+        out.write(reinterpret_cast<const char *>(data + sizeof(header) + header.keyLength), header.dataSize);
+        bytes = header.dataSize;
+        // Modification time orders entries for eviction
+        utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+    }
+    munmap(memory, status.st_size);
+    return valid;
+}
+
+void ProcessedCache::evict()
+{
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+    uint64_t total = 0;
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(this->directory, error))
+    {
+        if (entry.is_regular_file(error) && entry.path().extension() == ".bin")
+        {
+            total += entry.file_size(error);
+            entries.emplace_back(entry.last_write_time(error), entry.path());
+        }
+    }
+
+    std::sort(entries.begin(), entries.end());
+    for (const auto &[time, path] : entries)
+    {
+        if (total <= this->maxBytes)
+        {
+            break;
+        }
+        const uint64_t size = std::filesystem::file_size(path, error);
+        if (std::filesystem::remove(path, error))
+        {
+            total -= size;
+        }
+    }
+}
+
+ProcessedCache::Writer::Writer(ProcessedCache &cache, const std::string &key) : cache(cache), key(key)
+{
+    // Unique per writer, --process workers of one process may write entries of the same key at once
+    static std::atomic<uint64_t> nextWriter{0};
+    this->temporaryPath = cache.entryPath(key) + "." + std::to_string(getpid()) + "." + std::to_string(nextWriter++) + ".tmp";
+    this->file.open(this->temporaryPath, std::ios::binary | std::ios::trunc);
+    if (this->file.fail())
+    {
+        throw std::ios_base::failure("Open file failed: " + std::string(std::strerror(errno)));
+    }
+    ProcessedCacheHeader header = {PROCESSED_CACHE_MAGIC, (uint32_t)key.size(), 0};
+    this->file.write(reinterpret_cast<char *>(&header), sizeof(header));
+    this->file.write(key.data(), key.size());
+}
+
+ProcessedCache::Writer::~Writer()
+{
+    if (!this->committed)
+    {
+        this->file.close();
+        std::remove(this->temporaryPath.c_str());
+    }
+}
+
+void ProcessedCache::Writer::write(const char *data, size_t size)
+{
+    this->file.write(data, size);
+    this->dataSize += size;
+}
+
+void ProcessedCache::Writer::commit()
+{
+    ProcessedCacheHeader header = {PROCESSED_CACHE_MAGIC, (uint32_t)this->key.size(), this->dataSize};
+    this->file.seekp(0);
+    this->file.write(reinterpret_cast<char *>(&header), sizeof(header));
+    this->file.close();
+    if (this->file.fail())
+    {
+        Logger::log(error) << "Writing processed cache failed\n";
+        return;
+    }
+
+    // Rename is atomic, a concurrent reader sees either no entry or a complete one
+    std::error_code error;
+    std::filesystem::rename(this->temporaryPath, this->cache.entryPath(this->key), error);
+    this->committed = !error;
+    this->cache.evict();
+}
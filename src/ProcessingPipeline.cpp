@@ -0,0 +1,325 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcessingPipeline.h"
+#include "CirStage.h"
+#include "ComplexInterpolationStage.h"
+#include "CsiRatioStage.h"
+#include "DopplerStage.h"
+#include "FeatureStage.h"
+#include "HampelStage.h"
+#include "InterpolationStage.h"
+#include "MotionStage.h"
+#include "MusicStage.h"
+#include "PcaStage.h"
+#include "PhaseSanitizer.h"
+#include "ResampleStage.h"
+#include "StatisticsStage.h"
+#include "Logger.h"
+
+#include <sstream>
+#include <stdexcept>
+
+ProcessingPipeline::ProcessingPipeline(const std::string &spec) : spec(spec)
+{
+    std::istringstream specStream(spec);
+    std::string stageSpec;
+    std::string prefix;
+    while (std::getline(specStream, stageSpec, ','))
+    {
+        if (stageSpec.empty())
+        {
+            continue;
+        }
+
+        std::istringstream stageStream(stageSpec);
+        std::string name;
+        std::getline(stageStream, name, ':');
+
+        StageParams params;
+        std::string param;
+        while (std::getline(stageStream, param, ':'))
+        {
+            size_t separator = param.find('=');
+            if (separator == std::string::npos)
+            {
+                params[param] = "";
+            }
+            else
+            {
+                params[param.substr(0, separator)] = param.substr(separator + 1);
+            }
+        }
+
+        this->stages.push_back(ProcessingPipeline::createStage(name, params));
+
+        // Frames processed by a pipeline starting with the same stages can resume from here
+        prefix += prefix.empty() ? stageSpec : "," + stageSpec;
+        this->stageKeys.push_back(ProcessingPipeline::hashSpec(prefix));
+    }
+}
+
+uint64_t ProcessingPipeline::hashSpec(const std::string &spec)
+{
+    // FNV-1a, 0 is reserved for frames in raw state
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : spec)
+    {
+        hash = (hash ^ c) * 0x100000001b3ULL;
+    }
+    return hash ? hash : 1;
+}
+
+std::unique_ptr<ProcessingStage> ProcessingPipeline::createStage(const std::string &name, const StageParams &params)
+{
+    if (name == "interpolateLinear")
+    {
+        return std::make_unique<InterpolationStage>(processor::interpolateLinear);
+    }
+    if (name == "interpolateCubic")
+    {
+        return std::make_unique<InterpolationStage>(processor::interpolateCubic);
+    }
+    if (name == "interpolateCosine")
+    {
+        return std::make_unique<InterpolationStage>(processor::interpolateCosine);
+    }
+    if (name == "interpolateComplex")
+    {
+        return std::make_unique<ComplexInterpolationStage>(params);
+    }
+    if (name == "cir")
+    {
+        return std::make_unique<CirStage>(params);
+    }
+    if (name == "doppler")
+    {
+        return std::make_unique<DopplerStage>(params);
+    }
+    if (name == "hampel")
+    {
+        return std::make_unique<HampelStage>(params);
+    }
+    if (name == "statistics")
+    {
+        return std::make_unique<StatisticsStage>(params);
+    }
+    if (name == "pca")
+    {
+        return std::make_unique<PcaStage>(params);
+    }
+    if (name == "music")
+    {
+        return std::make_unique<MusicStage>(params);
+    }
+    if (name == "csiRatio")
+    {
+        return std::make_unique<CsiRatioStage>(params);
+    }
+    if (name == "resample")
+    {
+        return std::make_unique<ResampleStage>(params);
+    }
+    if (name == "motion")
+    {
+        return std::make_unique<MotionStage>(params);
+    }
+    if (name == "features")
+    {
+        return std::make_unique<FeatureStage>(params);
+    }
+    if (name == "phaseCalibration")
+    {
+        return std::make_unique<PhaseSanitizer>();
+    }
+    throw std::invalid_argument("Unknown processing stage: " + name);
+}
+
+std::string ProcessingPipeline::specFromProcessors(const std::map<enum processor, bool> &processors)
+{
+    auto enabled = [&processors](enum processor p)
+    {
+        auto it = processors.find(p);
+        return it != processors.end() && it->second;
+    };
+
+    std::string spec;
+    if (enabled(processor::interpolateLinear))
+    {
+        spec = "interpolateLinear";
+    }
+    else if (enabled(processor::interpolateCubic))
+    {
+        spec = "interpolateCubic";
+    }
+    else if (enabled(processor::interpolateCosine))
+    {
+        spec = "interpolateCosine";
+    }
+
+    if (enabled(processor::phaseCalibrationLinearTransform))
+    {
+        spec += spec.empty() ? "phaseCalibration" : ",phaseCalibration";
+    }
+    return spec;
+}
+
+void ProcessingPipeline::process(std::vector<Csi *> &batch)
+{
+    this->process(batch, 0, this->stages.size());
+}
+
+// Runs stages [first, last). Frames not processed exactly up to first are reset and go through all stages before last.
+void ProcessingPipeline::process(std::vector<Csi *> &batch, uint32_t first, uint32_t last)
+{
+    const uint64_t startKey = first ? this->stageKeys[first - 1] : 0;
+    const uint64_t key = last ? this->stageKeys[last - 1] : 0;
+    this->pending.clear();
+    for (Csi *csi : batch)
+    {
+        if (csi->processedKey == key || csi->processedKey == startKey)
+        {
+            continue;
+        }
+        if (csi->processedKey)
+        {
+            csi->reset();
+        }
+        this->pending.push_back(csi);
+    }
+
+    if (!this->pending.empty())
+    {
+        for (uint32_t i = 0; i < first; i++)
+        {
+            this->stages[i]->run(this->pending);
+        }
+        for (Csi *csi : this->pending)
+        {
+            csi->processedKey = startKey;
+        }
+    }
+
+    // Sequential stages rely on frames staying in batch order
+    this->pending.clear();
+    for (Csi *csi : batch)
+    {
+        if (csi->processedKey == startKey && csi->processedKey != key)
+        {
+            this->pending.push_back(csi);
+        }
+    }
+    if (this->pending.empty())
+    {
+        return;
+    }
+
+    for (uint32_t i = first; i < last; i++)
+    {
+        this->stages[i]->run(this->pending);
+    }
+    for (Csi *csi : this->pending)
+    {
+        csi->processedKey = key;
+    }
+}
+
+void ProcessingPipeline::process(Csi &csi)
+{
+    const uint64_t key = this->getKey();
+    if (csi.processedKey == key)
+    {
+        return;
+    }
+
+    // Continue after the last stage this frame already went through, otherwise start from raw
+    uint32_t first = 0;
+    for (uint32_t i = this->stageKeys.size(); i > 0; i--)
+    {
+        if (csi.processedKey == this->stageKeys[i - 1])
+        {
+            first = i;
+            break;
+        }
+    }
+    if (first == 0 && csi.processedKey)
+    {
+        csi.reset();
+    }
+
+    this->singleFrame.assign(1, &csi);
+    for (uint32_t i = first; i < this->stages.size(); i++)
+    {
+        this->stages[i]->run(this->singleFrame);
+        csi.processedKey = this->stageKeys[i];
+    }
+}
+
+uint64_t ProcessingPipeline::getKey() const
+{
+    return this->stageKeys.empty() ? 0 : this->stageKeys.back();
+}
+
+uint32_t ProcessingPipeline::getSequentialStart() const
+{
+    for (uint32_t i = 0; i < this->stages.size(); i++)
+    {
+        if (this->stages[i]->isSequential())
+        {
+            return i;
+        }
+    }
+    return this->stages.size();
+}
+
+bool ProcessingPipeline::empty() const
+{
+    return this->stages.empty();
+}
+
+bool ProcessingPipeline::hasOutput() const
+{
+    for (const std::unique_ptr<ProcessingStage> &stage : this->stages)
+    {
+        if (stage->hasOutput())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::string &ProcessingPipeline::getSpec() const
+{
+    return this->spec;
+}
+
+const std::vector<std::unique_ptr<ProcessingStage>> &ProcessingPipeline::getStages() const
+{
+    return this->stages;
+}
+
+void ProcessingPipeline::printStatistics()
+{
+    for (std::unique_ptr<ProcessingStage> &stage : this->stages)
+    {
+        double ms = stage->processingTimeNs / 1e6;
+        double fps = stage->processingTimeNs ? stage->processedFrames * 1e9 / stage->processingTimeNs : 0;
+        Logger::log(info) << "Stage " << stage->name() << ": " << stage->processedFrames << " frames, " << ms << " ms, " << fps << " frames/s\n";
+    }
+}
@@ -0,0 +1,31 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcessingStage.h"
+
+#include <chrono>
+
+void ProcessingStage::run(std::vector<Csi *> &batch)
+{
+    auto start = std::chrono::steady_clock::now();
+    this->process(batch);
+    auto end = std::chrono::steady_clock::now();
+
+    this->processedFrames += batch.size();
+    this->processingTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
@@ -0,0 +1,55 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RecordFile.h"
+
+#include <filesystem>
+#include <ios>
+
+RecordFile::RecordFile(const std::string &path) : path(path)
+{
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    if (!directory.empty() && !std::filesystem::is_directory(directory))
+    {
+        throw std::ios_base::failure("Output directory does not exist: " + path);
+    }
+}
+
+bool RecordFile::isSet() const
+{
+    return !this->path.empty();
+}
+
+void RecordFile::write(const void *data, size_t size)
+{
+    if (!this->stream.is_open())
+    {
+        this->stream.open(this->path, std::ios_base::app | std::ios::binary);
+        if (this->stream.fail())
+        {
+            throw std::ios_base::failure("Open file failed: " + this->path);
+        }
+    }
+    this->stream.write(static_cast<const char *>(data), size);
+}
+
+void RecordFile::write(const void *header, size_t headerSize, const void *payload, size_t payloadSize)
+{
+    this->write(header, headerSize);
+    this->write(payload, payloadSize);
+}
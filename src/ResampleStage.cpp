@@ -0,0 +1,210 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ResampleStage.h"
+#include "MatrixKernels.h"
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+    struct TargetLayout
+    {
+        std::vector<int16_t> k;
+        SubcarrierLayout layout;
+        double spacing;
+    };
+
+    // Layouts of target grids live as long as the program, frames keep pointers to them
+    std::mutex targetMutex;
+    std::map<std::pair<uint32_t, double>, std::unique_ptr<TargetLayout>> targetLayouts;
+
+    const SubcarrierLayout *getTargetLayout(uint32_t bins, double spacing)
+    {
+        std::lock_guard<std::mutex> lock(targetMutex);
+        std::unique_ptr<TargetLayout> &target = targetLayouts[{bins, spacing}];
+        if (!target)
+        {
+            target = std::make_unique<TargetLayout>();
+            target->spacing = spacing;
+            double sum = 0;
+            for (uint32_t j = 0; j < bins; j++)
+            {
+                target->k.push_back((int16_t)j - (int16_t)(bins / 2));
+                sum += target->k.back();
+            }
+            const double mean = sum / bins;
+            double sumSquares = 0;
+            for (int16_t k : target->k)
+            {
+                sumSquares += (k - mean) * (k - mean);
+            }
+            target->layout = {0, 0, bins, bins, target->k.data(), nullptr, 0, nullptr, 0, 0, 0, mean, 1 / sumSquares};
+        }
+        return &target->layout;
+    }
+
+    // Distance of neighbouring k in Hz, frames resampled before have the spacing of their target grid
+    double getToneSpacing(const SubcarrierLayout &layout)
+    {
+        std::lock_guard<std::mutex> lock(targetMutex);
+        for (const auto &[key, target] : targetLayouts)
+        {
+            if (&target->layout == &layout)
+            {
+                return target->spacing;
+            }
+        }
+        const uint32_t bandwidth = 20 << ((layout.channelWidth & RATE_MCS_CHAN_WIDTH_MSK) >> RATE_MCS_CHAN_WIDTH_POS);
+        return bandwidth * 1e6 / layout.fftSize;
+    }
+}
+
+ResampleStage::ResampleStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "bins")
+        {
+            this->bins = std::stoul(value);
+        }
+        else if (key == "spacing")
+        {
+            this->spacing = std::stod(value) * 1e3;
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of resample: " + key);
+        }
+    }
+
+    if (this->bins < 2 || this->bins > INT16_MAX || this->spacing <= 0)
+    {
+        throw std::invalid_argument("Resample needs 2 <= bins <= 32767 and spacing > 0");
+    }
+    this->targetLayout = getTargetLayout(this->bins, this->spacing);
+}
+
+const char *ResampleStage::name() const
+{
+    return "resample";
+}
+
+void ResampleStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->resample(*csi);
+    }
+}
+
+void ResampleStage::resample(Csi &csi)
+{
+    if (!csi.layout || csi.layout == this->targetLayout)
+    {
+        return;
+    }
+
+    const Matrix &matrix = this->getMatrix(*csi.layout);
+    const uint32_t chains = csi.numRx * csi.numTx;
+    this->resampled.resize(chains * this->bins);
+    for (uint32_t c = 0; c < chains; c++)
+    {
+        matrixKernels::sparseMultiply(matrix.offsets.data(), matrix.columns.data(), matrix.weights.data(), this->bins,
+                                      &csi.csi[c * csi.numSubCarriers], &this->resampled[c * this->bins]);
+    }
+
+    csi.csi.assign(this->resampled.begin(), this->resampled.end());
+    csi.numSubCarriers = this->bins;
+    csi.layout = this->targetLayout;
+    csi.recalcMagnitudePhase();
+}
+
+const ResampleStage::Matrix &ResampleStage::getMatrix(const SubcarrierLayout &layout)
+{
+    auto it = this->matrices.find(&layout);
+    if (it != this->matrices.end())
+    {
+        return it->second;
+    }
+
+    Matrix &matrix = this->matrices[&layout];
+    const double sourceSpacing = getToneSpacing(layout);
+    const uint32_t n = layout.numSubCarriers;
+    auto frequency = [&](uint32_t i)
+    {
+        return layout.k[i] * sourceSpacing;
+    };
+
+    matrix.offsets.push_back(0);
+    uint32_t right = 0;
+    for (uint32_t j = 0; j < this->bins; j++)
+    {
+        const double f = ((double)j - this->bins / 2) * this->spacing;
+        const double half = this->spacing / 2;
+        if (f < frequency(0) - half || f > frequency(n - 1) + half)
+        {
+            // Outside of the reported band
+            matrix.offsets.push_back(matrix.columns.size());
+            continue;
+        }
+
+        // Coarser target, average of the reported tones inside the target tone
+        const uint32_t first = matrix.columns.size();
+        if (this->spacing > sourceSpacing)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                if (std::abs(frequency(i) - f) < half)
+                {
+                    matrix.columns.push_back(i);
+                }
+            }
+            const uint32_t count = matrix.columns.size() - first;
+            matrix.weights.resize(matrix.columns.size(), count ? 1.0 / count : 0);
+        }
+
+        // Finer target or no reported tone inside (DC, nulls), linear interpolation between the neighbouring reported tones
+        if (matrix.columns.size() == first)
+        {
+            while (right < n - 1 && frequency(right) < f)
+            {
+                right++;
+            }
+            if (right == 0 || frequency(right) <= f)
+            {
+                matrix.columns.push_back(right);
+                matrix.weights.push_back(1);
+            }
+            else
+            {
+                const double s = (f - frequency(right - 1)) / (frequency(right) - frequency(right - 1));
+                matrix.columns.push_back(right - 1);
+                matrix.weights.push_back(1 - s);
+                matrix.columns.push_back(right);
+                matrix.weights.push_back(s);
+            }
+        }
+        matrix.offsets.push_back(matrix.columns.size());
+    }
+    return matrix;
+}
@@ -0,0 +1,161 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RunningStatistics.h"
+
+#include <algorithm>
+#include <iterator>
+
+SlidingMoments::SlidingMoments(uint32_t window) : values(std::max(1u, window))
+{
+}
+
+void SlidingMoments::push(double value)
+{
+    if (this->count == this->values.size())
+    {
+        const double removed = this->values[this->next];
+        this->count--;
+        if (this->count == 0)
+        {
+            this->runningMean = 0;
+            this->m2 = 0;
+        }
+        else
+        {
+            const double delta = removed - this->runningMean;
+            this->runningMean -= delta / this->count;
+            this->m2 -= delta * (removed - this->runningMean);
+        }
+    }
+
+    this->values[this->next] = value;
+    this->next = (this->next + 1) % this->values.size();
+    this->count++;
+
+    const double delta = value - this->runningMean;
+    this->runningMean += delta / this->count;
+    this->m2 += delta * (value - this->runningMean);
+
+    // Removals accumulate rounding error, recompute exactly once per full window, amortized O(1)
+    if (this->next == 0 && this->count == this->values.size())
+    {
+        double sum = 0;
+        for (double v : this->values)
+        {
+            sum += v;
+        }
+        this->runningMean = sum / this->count;
+        this->m2 = 0;
+        for (double v : this->values)
+        {
+            this->m2 += (v - this->runningMean) * (v - this->runningMean);
+        }
+    }
+}
+
+double SlidingMoments::mean() const
+{
+    return this->runningMean;
+}
+
+// Sample variance, rounding can leave tiny negative m2 after many removals
+double SlidingMoments::variance() const
+{
+    return this->count > 1 ? std::max(0.0, this->m2 / (this->count - 1)) : 0;
+}
+
+uint32_t SlidingMoments::size() const
+{
+    return this->count;
+}
+
+SlidingMedian::SlidingMedian(uint32_t window) : values(std::max(1u, window))
+{
+}
+
+void SlidingMedian::push(double value)
+{
+    if (this->count == this->values.size())
+    {
+        this->erase(this->values[this->next]);
+        this->rebalance();
+        this->count--;
+    }
+
+    this->values[this->next] = value;
+    this->next = (this->next + 1) % this->values.size();
+    this->count++;
+
+    if (this->low.empty() || value <= *this->low.rbegin())
+    {
+        this->low.insert(value);
+    }
+    else
+    {
+        this->high.insert(value);
+    }
+    this->rebalance();
+}
+
+double SlidingMedian::median() const
+{
+    if (this->low.empty())
+    {
+        return 0;
+    }
+    if (this->low.size() > this->high.size())
+    {
+        return *this->low.rbegin();
+    }
+    return (*this->low.rbegin() + *this->high.begin()) / 2;
+}
+
+uint32_t SlidingMedian::size() const
+{
+    return this->count;
+}
+
+void SlidingMedian::erase(double value)
+{
+    if (!this->low.empty() && value <= *this->low.rbegin())
+    {
+        this->low.erase(this->low.find(value));
+    }
+    else
+    {
+        this->high.erase(this->high.find(value));
+    }
+}
+
+// Keeps low.size() equal to high.size() or one larger
+void SlidingMedian::rebalance()
+{
+    if (this->low.size() > this->high.size() + 1)
+    {
+        auto it = std::prev(this->low.end());
+        this->high.insert(*it);
+        this->low.erase(it);
+    }
+    else if (this->high.size() > this->low.size())
+    {
+        auto it = this->high.begin();
+        this->low.insert(*it);
+        this->high.erase(it);
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedMemoryRing.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <ios>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SharedMemoryRing::SharedMemoryRing(const std::string &name, uint32_t slotSize, uint32_t capacity) : name(name[0] == '/' ? name : "/" + name)
+{
+    if (slotSize == 0 || capacity == 0)
+    {
+        throw std::invalid_argument("Shared memory ring needs slot size and capacity");
+    }
+
+    this->mappedSize = sizeof(SharedMemoryRingHeader) + slotStride(slotSize) * capacity;
+    int fd = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd == -1)
+    {
+        throw std::ios_base::failure("Open shared memory failed: " + std::string(std::strerror(errno)));
+    }
+    if (ftruncate(fd, this->mappedSize) == -1)
+    {
+        close(fd);
+        throw std::ios_base::failure("Resize shared memory failed: " + std::string(std::strerror(errno)));
+    }
+    void *memory = mmap(nullptr, this->mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        throw std::ios_base::failure("Map shared memory failed: " + std::string(std::strerror(errno)));
+    }
+
+    this->header = new (memory) SharedMemoryRingHeader;
+    this->header->slotSize = slotSize;
+    this->header->capacity = capacity;
+    this->header->reserved = 0;
+    this->header->written.store(0, std::memory_order_relaxed);
+    this->header->magic = SHARED_MEMORY_RING_MAGIC;
+    this->slots = static_cast<uint8_t *>(memory) + sizeof(SharedMemoryRingHeader);
+    // Sequences left by a previous writer of the same name could match the restarted count
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        SharedMemoryRingSlot *slot = new (this->slots + i * slotStride(slotSize)) SharedMemoryRingSlot;
+        slot->sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    munmap(this->header, this->mappedSize);
+    shm_unlink(this->name.c_str());
+}
+
+void SharedMemoryRing::write(const void *data, uint32_t size)
+{
+    const uint64_t n = this->header->written.load(std::memory_order_relaxed);
+    uint8_t *slot = this->slots + (n % this->header->capacity) * slotStride(this->header->slotSize);
+    std::atomic<uint64_t> &sequence = reinterpret_cast<SharedMemoryRingSlot *>(slot)->sequence;
+    sequence.store(2 * n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(slot + sizeof(SharedMemoryRingSlot), data, std::min(size, this->header->slotSize));
+    sequence.store(2 * n + 2, std::memory_order_release);
+    this->header->written.store(n + 1, std::memory_order_release);
+}
+
+uint32_t SharedMemoryRing::getSlotSize() const
+{
+    return this->header->slotSize;
+}
+
+// Sequence followed by the record, padded so the next sequence stays aligned
+size_t SharedMemoryRing::slotStride(uint32_t slotSize)
+{
+    const size_t align = alignof(SharedMemoryRingSlot);
+    return (sizeof(SharedMemoryRingSlot) + slotSize + align - 1) / align * align;
+}
+
+SharedMemoryRingReader::SharedMemoryRingReader(const std::string &name)
+{
+    const std::string path = name[0] == '/' ? name : "/" + name;
+    int fd = shm_open(path.c_str(), O_RDONLY, 0);
+    if (fd == -1)
+    {
+        throw std::ios_base::failure("Open shared memory failed: " + std::string(std::strerror(errno)));
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(SharedMemoryRingHeader))
+    {
+        close(fd);
+        throw std::ios_base::failure("Shared memory is not a ring: " + path);
+    }
+    this->mappedSize = st.st_size;
+    void *memory = mmap(nullptr, this->mappedSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        throw std::ios_base::failure("Map shared memory failed: " + std::string(std::strerror(errno)));
+    }
+
+    this->header = static_cast<const SharedMemoryRingHeader *>(memory);
+    this->slots = static_cast<const uint8_t *>(memory) + sizeof(SharedMemoryRingHeader);
+    if (this->header->magic != SHARED_MEMORY_RING_MAGIC || this->header->capacity == 0 || sizeof(SharedMemoryRingHeader) + SharedMemoryRing::slotStride(this->header->slotSize) * this->header->capacity > this->mappedSize)
+    {
+        munmap(memory, this->mappedSize);
+        throw std::ios_base::failure("Shared memory is not a ring: " + path);
+    }
+}
+
+SharedMemoryRingReader::~SharedMemoryRingReader()
+{
+    munmap(const_cast<SharedMemoryRingHeader *>(this->header), this->mappedSize);
+}
+
+bool SharedMemoryRingReader::read(uint64_t n, void *out) const
+{
+    const uint8_t *slot = this->slots + (n % this->header->capacity) * SharedMemoryRing::slotStride(this->header->slotSize);
+    const std::atomic<uint64_t> &sequence = reinterpret_cast<const SharedMemoryRingSlot *>(slot)->sequence;
+    const uint64_t before = sequence.load(std::memory_order_acquire);
+    if (before != 2 * n + 2)
+    {
+        return false;
+    }
+    memcpy(out, slot + sizeof(SharedMemoryRingSlot), this->header->slotSize);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence.load(std::memory_order_relaxed) == before;
+}
+
+uint64_t SharedMemoryRingReader::getWritten() const
+{
+    return this->header->written.load(std::memory_order_acquire);
+}
+
+uint32_t SharedMemoryRingReader::getSlotSize() const
+{
+    return this->header->slotSize;
+}
+
+uint32_t SharedMemoryRingReader::getCapacity() const
+{
+    return this->header->capacity;
+}
@@ -0,0 +1,126 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatisticsStage.h"
+
+#include <cstring>
+#include <stdexcept>
+
+StatisticsStage::StatisticsStage(const StageParams &params)
+{
+    for (const auto &[key, value] : params)
+    {
+        if (key == "window")
+        {
+            this->window = std::stoul(value);
+        }
+        else if (key == "alpha")
+        {
+            this->alpha = std::stod(value);
+        }
+        else if (key == "every")
+        {
+            this->every = std::stoul(value);
+        }
+        else if (key == "output")
+        {
+            this->output = RecordFile(value);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown parameter of statistics: " + key);
+        }
+    }
+
+    if (this->window == 0 || this->every == 0)
+    {
+        throw std::invalid_argument("Statistics window and every have to be at least 1");
+    }
+    if (this->alpha <= 0 || this->alpha > 1)
+    {
+        throw std::invalid_argument("Statistics alpha has to be in (0, 1]");
+    }
+}
+
+const char *StatisticsStage::name() const
+{
+    return "statistics";
+}
+
+bool StatisticsStage::isSequential() const
+{
+    return true;
+}
+
+bool StatisticsStage::hasOutput() const
+{
+    return this->output.isSet();
+}
+
+const std::vector<SubcarrierStatistics> *StatisticsStage::getStatistics(uint64_t mac) const
+{
+    auto it = this->streams.find(mac);
+    return it == this->streams.end() ? nullptr : &it->second.statistics;
+}
+
+void StatisticsStage::process(std::vector<Csi *> &batch)
+{
+    for (Csi *csi : batch)
+    {
+        this->update(*csi);
+    }
+}
+
+void StatisticsStage::update(Csi &csi)
+{
+    Stream &stream = this->streams[csi.getSourceMac()];
+    const uint32_t size = csi.magnitude.size();
+    if (stream.numValues != size)
+    {
+        stream.numValues = size;
+        stream.count = 0;
+        stream.moments.assign(size, SlidingMoments(this->window));
+        stream.medians.assign(size, SlidingMedian(this->window));
+        stream.statistics.assign(size, SubcarrierStatistics());
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        const double value = csi.magnitude[i];
+        stream.moments[i].push(value);
+        stream.medians[i].push(value);
+
+        SubcarrierStatistics &statistics = stream.statistics[i];
+        statistics.mean = stream.moments[i].mean();
+        statistics.variance = stream.moments[i].variance();
+        statistics.median = stream.medians[i].median();
+        statistics.ema = stream.count ? statistics.ema + this->alpha * (value - statistics.ema) : value;
+    }
+    stream.count++;
+
+    if (this->output.isSet() && stream.count % this->every == 0)
+    {
+        StatisticsHeader header;
+        header.timestamp = csi.rawHeaderData.timestamp;
+        memcpy(header.srcMac, csi.rawHeaderData.srcMac, sizeof(header.srcMac));
+        header.numChains = csi.numRx * csi.numTx;
+        header.numSubCarriers = csi.numSubCarriers;
+        header.numFrames = stream.moments.empty() ? 0 : stream.moments[0].size();
+        this->output.write(&header, sizeof(StatisticsHeader), stream.statistics.data(), stream.statistics.size() * sizeof(SubcarrierStatistics));
+    }
+}
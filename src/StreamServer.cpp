@@ -0,0 +1,515 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StreamServer.h"
+#include "Arguments.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <ios>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Frames gathered by one sendmsg call
+#define STREAM_SERVER_IOVECS 64
+// How long queued frames are still sent after the server is stopped
+#define STREAM_SERVER_DRAIN_MS 1000
+
+StreamServer::StreamServer(const std::string &address, uint32_t maxQueue, enum overflow policy)
+    : maxQueue(std::max<uint32_t>(1, maxQueue)), policy(policy)
+{
+    this->listen(address);
+
+    this->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    this->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (this->epollFd == -1 || this->wakeFd == -1)
+    {
+        const std::string reason = std::strerror(errno);
+        close(this->listenFd);
+        if (this->epollFd != -1)
+        {
+            close(this->epollFd);
+        }
+        throw std::ios_base::failure("Stream server setup failed: " + reason);
+    }
+    // Clients are told apart by id, the fd of a closed client may be reused while its events are handled
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = this->listenFd;
+    epoll_ctl(this->epollFd, EPOLL_CTL_ADD, this->listenFd, &event);
+    event.data.u64 = this->wakeFd;
+    epoll_ctl(this->epollFd, EPOLL_CTL_ADD, this->wakeFd, &event);
+
+    this->server = std::thread(&StreamServer::serve, this);
+}
+
+StreamServer::~StreamServer()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->writable.notify_all();
+    uint64_t one = 1;
+    ::write(this->wakeFd, &one, sizeof(one));
+    this->server.join();
+
+    for (auto &[fd, client] : this->clients)
+    {
+        close(fd);
+    }
+    close(this->listenFd);
+    close(this->epollFd);
+    close(this->wakeFd);
+    if (!this->unixPath.empty())
+    {
+        unlink(this->unixPath.c_str());
+    }
+}
+
+StreamServer::overflow StreamServer::parseOverflow(const std::string &name)
+{
+    if (name == "drop-oldest")
+    {
+        return overflow::dropOldest;
+    }
+    if (name == "disconnect")
+    {
+        return overflow::disconnect;
+    }
+    if (name == "block")
+    {
+        return overflow::block;
+    }
+    throw std::invalid_argument("Unknown stream overflow policy: " + name);
+}
+
+void StreamServer::listen(const std::string &address)
+{
+    if (address.rfind("unix:", 0) == 0)
+    {
+        this->unixPath = address.substr(5);
+        struct sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        if (this->unixPath.empty() || this->unixPath.size() >= sizeof(addr.sun_path))
+        {
+            throw std::invalid_argument("Stream server socket path is empty or too long: " + this->unixPath);
+        }
+        strcpy(addr.sun_path, this->unixPath.c_str());
+        // Left over by a previous run which did not exit cleanly
+        std::error_code ec;
+        if (std::filesystem::is_socket(this->unixPath, ec))
+        {
+            unlink(this->unixPath.c_str());
+        }
+
+        this->listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (this->listenFd != -1 && bind(this->listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+        {
+            close(this->listenFd);
+            this->listenFd = -1;
+        }
+    }
+    else
+    {
+        // [HOST:]PORT, IPv6 hosts in brackets
+        std::string host;
+        std::string port = address;
+        size_t separator = address.rfind(':');
+        if (separator != std::string::npos)
+        {
+            host = address.substr(0, separator);
+            port = address.substr(separator + 1);
+            if (host.size() >= 2 && host.front() == '[' && host.back() == ']')
+            {
+                host = host.substr(1, host.size() - 2);
+            }
+        }
+
+        struct addrinfo hints = {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_PASSIVE;
+        struct addrinfo *result;
+        int s = getaddrinfo(host.empty() ? NULL : host.c_str(), port.c_str(), &hints, &result);
+        if (s != 0)
+        {
+            throw std::invalid_argument("Stream server address " + address + ": " + gai_strerror(s));
+        }
+        for (struct addrinfo *rp = result; rp != NULL; rp = rp->ai_next)
+        {
+            this->listenFd = socket(rp->ai_family, rp->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, rp->ai_protocol);
+            if (this->listenFd == -1)
+            {
+                continue;
+            }
+            int reuse = 1;
+            setsockopt(this->listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            if (bind(this->listenFd, rp->ai_addr, rp->ai_addrlen) == 0)
+            {
+                break;
+            }
+            close(this->listenFd);
+            this->listenFd = -1;
+        }
+        freeaddrinfo(result);
+    }
+
+    if (this->listenFd == -1 || ::listen(this->listenFd, SOMAXCONN) != 0)
+    {
+        const std::string reason = std::strerror(errno);
+        if (this->listenFd != -1)
+        {
+            close(this->listenFd);
+        }
+        throw std::ios_base::failure("Stream server can not listen on " + address + ": " + reason);
+    }
+}
+
+void StreamServer::send(const void *header, size_t headerSize, const void *payload, size_t payloadSize)
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (this->clients.empty())
+    {
+        return;
+    }
+    lock.unlock();
+
+    // One copy shared by all clients, the caller's buffers are reused right away
+    auto data = std::make_shared<std::vector<uint8_t>>(headerSize + payloadSize);
+    memcpy(data->data(), header, headerSize);
+    memcpy(data->data() + headerSize, payload, payloadSize);
+    const Frame frame = data;
+
+    lock.lock();
+    bool wake = false;
+    for (auto it = this->clients.begin(); it != this->clients.end();)
+    {
+        const int fd = it->first;
+        Client *client = &it->second;
+        if (client->queue.size() >= this->maxQueue)
+        {
+            if (this->policy == overflow::disconnect)
+            {
+                ++it;
+                this->disconnectedClients++;
+                this->closeClient(fd, "send queue full");
+                continue;
+            }
+            if (this->policy == overflow::block)
+            {
+                if (wake)
+                {
+                    uint64_t one = 1;
+                    ::write(this->wakeFd, &one, sizeof(one));
+                    wake = false;
+                }
+                this->blockedSends++;
+                this->writable.wait(lock, [this, fd]
+                                    {
+                    auto waited = this->clients.find(fd);
+                    return this->stopping || waited == this->clients.end() || waited->second.queue.size() < this->maxQueue; });
+                if (this->stopping)
+                {
+                    return;
+                }
+                // Clients may have come and gone while waiting
+                it = this->clients.lower_bound(fd);
+                if (it == this->clients.end() || it->first != fd)
+                {
+                    continue;
+                }
+                client = &it->second;
+            }
+            else if (client->offset && client->queue.size() == 1)
+            {
+                // Only the partly sent frame is queued, drop the new one
+                client->droppedFrames++;
+                this->droppedFrames++;
+                ++it;
+                continue;
+            }
+            else
+            {
+                // The front frame may be partly sent, dropping it would break the stream
+                client->queue.erase(client->offset ? std::next(client->queue.begin()) : client->queue.begin());
+                client->droppedFrames++;
+                this->droppedFrames++;
+            }
+        }
+        wake |= client->queue.empty() && !client->waitingWritable;
+        client->queue.push_back(frame);
+        ++it;
+    }
+    lock.unlock();
+
+    if (wake)
+    {
+        uint64_t one = 1;
+        ::write(this->wakeFd, &one, sizeof(one));
+    }
+}
+
+void StreamServer::serve()
+{
+    struct epoll_event events[STREAM_SERVER_MAX_EVENTS];
+    std::chrono::steady_clock::time_point drainDeadline;
+    bool draining = false;
+    while (true)
+    {
+        int n = epoll_wait(this->epollFd, events, STREAM_SERVER_MAX_EVENTS, draining ? 10 : -1);
+        if (n < 0 && errno != EINTR)
+        {
+            Logger::log(error) << "Stream server epoll failed: " << std::strerror(errno) << "\n";
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        for (int i = 0; i < n; i++)
+        {
+            const uint64_t id = events[i].data.u64;
+            if (id == (uint64_t)this->listenFd)
+            {
+                this->accept();
+                continue;
+            }
+            if (id == (uint64_t)this->wakeFd)
+            {
+                uint64_t count;
+                ::read(this->wakeFd, &count, sizeof(count));
+                for (auto it = this->clients.begin(); it != this->clients.end();)
+                {
+                    Client &client = (it++)->second;
+                    if (!client.waitingWritable && !client.queue.empty())
+                    {
+                        this->write(client);
+                    }
+                }
+                continue;
+            }
+
+            auto it = this->clients.find(id & 0xffffffff);
+            if (it == this->clients.end() || it->second.id != id)
+            {
+                continue;
+            }
+            Client &client = it->second;
+            if (events[i].events & EPOLLIN)
+            {
+                // Clients have nothing to say, reading only notices them leaving
+                char buf[256];
+                ssize_t r = ::read(client.fd, buf, sizeof(buf));
+                if (r == 0 || (r < 0 && errno != EAGAIN && errno != EINTR))
+                {
+                    this->closeClient(client.fd, "disconnected");
+                    continue;
+                }
+            }
+            if (events[i].events & (EPOLLERR | EPOLLHUP))
+            {
+                this->closeClient(client.fd, "disconnected");
+                continue;
+            }
+            if (events[i].events & EPOLLOUT)
+            {
+                this->write(client);
+            }
+        }
+
+        if (this->stopping)
+        {
+            // Queued frames still go out, for a while
+            if (!draining)
+            {
+                draining = true;
+                drainDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(STREAM_SERVER_DRAIN_MS);
+            }
+            bool queued = std::any_of(this->clients.begin(), this->clients.end(), [](const auto &client)
+                                      { return !client.second.queue.empty(); });
+            if (!queued || std::chrono::steady_clock::now() >= drainDeadline)
+            {
+                break;
+            }
+        }
+    }
+}
+
+// Called with mutex held
+void StreamServer::accept()
+{
+    while (true)
+    {
+        struct sockaddr_storage addr;
+        socklen_t addrLen = sizeof(addr);
+        int fd = accept4(this->listenFd, (struct sockaddr *)&addr, &addrLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            return;
+        }
+
+        Client &client = this->clients[fd];
+        client = Client();
+        client.fd = fd;
+        client.id = ((uint64_t)++this->nextClientId << 32) | (uint32_t)fd;
+        char host[NI_MAXHOST], service[NI_MAXSERV];
+        if (addr.ss_family == AF_UNIX)
+        {
+            client.name = "unix:" + this->unixPath;
+        }
+        else
+        {
+            // Frames are written whole, waiting for more data only adds latency
+            int noDelay = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            if (getnameinfo((struct sockaddr *)&addr, addrLen, host, NI_MAXHOST, service, NI_MAXSERV, NI_NUMERICHOST | NI_NUMERICSERV) == 0)
+            {
+                client.name = std::string(host) + ":" + service;
+            }
+        }
+
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = client.id;
+        epoll_ctl(this->epollFd, EPOLL_CTL_ADD, fd, &event);
+        if (Arguments::arguments.verbose)
+        {
+            Logger::log(info) << "Stream client " << client.name << " connected\n";
+        }
+    }
+}
+
+// Sends queued frames until the socket buffer is full, called with mutex held
+void StreamServer::write(Client &client)
+{
+    struct iovec iov[STREAM_SERVER_IOVECS];
+    while (!client.queue.empty())
+    {
+        int count = 0;
+        for (auto frame = client.queue.begin(); frame != client.queue.end() && count < STREAM_SERVER_IOVECS; ++frame)
+        {
+            const size_t skip = count == 0 ? client.offset : 0;
+            iov[count++] = {const_cast<uint8_t *>((*frame)->data()) + skip, (*frame)->size() - skip};
+        }
+        struct msghdr message = {};
+        message.msg_iov = iov;
+        message.msg_iovlen = count;
+        ssize_t written = sendmsg(client.fd, &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                if (!client.waitingWritable)
+                {
+                    struct epoll_event event = {};
+                    event.events = EPOLLIN | EPOLLOUT;
+                    event.data.u64 = client.id;
+                    epoll_ctl(this->epollFd, EPOLL_CTL_MOD, client.fd, &event);
+                    client.waitingWritable = true;
+                }
+                return;
+            }
+            this->closeClient(client.fd, std::strerror(errno));
+            return;
+        }
+
+        while (written > 0)
+        {
+            const size_t remaining = client.queue.front()->size() - client.offset;
+            if ((size_t)written < remaining)
+            {
+                client.offset += written;
+                break;
+            }
+            written -= remaining;
+            client.queue.pop_front();
+            client.offset = 0;
+            client.sentFrames++;
+            this->sentFrames++;
+        }
+        if (this->policy == overflow::block)
+        {
+            this->writable.notify_all();
+        }
+    }
+
+    if (client.waitingWritable)
+    {
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = client.id;
+        epoll_ctl(this->epollFd, EPOLL_CTL_MOD, client.fd, &event);
+        client.waitingWritable = false;
+    }
+}
+
+// Called with mutex held
+void StreamServer::closeClient(int fd, const char *reason)
+{
+    auto it = this->clients.find(fd);
+    if (it == this->clients.end())
+    {
+        return;
+    }
+    if (Arguments::arguments.verbose)
+    {
+        Logger::log(info) << "Stream client " << it->second.name << " " << reason << ", " << it->second.sentFrames << " frames sent, " << it->second.droppedFrames << " dropped\n";
+    }
+    epoll_ctl(this->epollFd, EPOLL_CTL_DEL, fd, NULL);
+    close(fd);
+    this->clients.erase(it);
+    if (this->policy == overflow::block)
+    {
+        this->writable.notify_all();
+    }
+}
+
+size_t StreamServer::getClientCount()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->clients.size();
+}
+
+void StreamServer::printStatistics()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    Logger::log(info) << "Stream: " << this->sentFrames << " frames sent, " << this->droppedFrames << " dropped, " << this->disconnectedClients << " clients disconnected on full queue, " << this->blockedSends << " sends blocked\n";
+    for (const auto &[fd, client] : this->clients)
+    {
+        Logger::log(info) << "Stream client " << client.name << ": " << client.sentFrames << " frames sent, " << client.droppedFrames << " dropped, " << client.queue.size() << " queued\n";
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * FeitCSI is the tool for extracting CSI information from supported intel NICs.
+ * Copyright (C) 2026 Miroslav Hutar.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UdpBatchSender.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+UdpBatchSender::UdpBatchSender(UdpSocket *udpSocket, uint32_t maxBatch, uint32_t maxLatencyUs, uint32_t mtu)
+    : udpSocket(udpSocket), maxBatch(std::clamp<uint32_t>(maxBatch, 1, UIO_MAXIOV)), maxLatency(maxLatencyUs)
+{
+    if (mtu)
+    {
+        this->chunkPayload = std::max<uint32_t>(mtu, CSI_CHUNK_MIN_MTU) - CSI_CHUNK_IP_OVERHEAD - sizeof(CsiChunkHeader);
+    }
+    this->messages.resize(this->maxBatch);
+    this->iovecs.resize(this->maxBatch * UDP_BATCH_IOVECS);
+    this->chunkHeaders.resize(this->maxBatch);
+    this->recipients.resize(this->maxBatch);
+    for (uint32_t i = 0; i < this->maxBatch; i++)
+    {
+        memset(&this->messages[i], 0, sizeof(struct mmsghdr));
+        this->messages[i].msg_hdr.msg_iov = &this->iovecs[i * UDP_BATCH_IOVECS];
+    }
+    this->flusher = std::thread(&UdpBatchSender::flushLoop, this);
+}
+
+UdpBatchSender::~UdpBatchSender()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->flushLocked();
+        this->stopping = true;
+    }
+    this->wake.notify_all();
+    this->flusher.join();
+}
+
+void UdpBatchSender::add(const void *header, size_t headerSize, const void *payload, size_t payloadSize, UdpRecipients recipients)
+{
+    if (!recipients.mask)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const auto now = std::chrono::steady_clock::now();
+    if (this->queued == 0)
+    {
+        this->firstQueued = now;
+        this->wake.notify_one();
+    }
+    this->addedFrames++;
+
+    const uint32_t frameSize = headerSize + payloadSize;
+    if (!this->chunkPayload)
+    {
+        this->queue(header, headerSize, payload, payloadSize, 0, frameSize, recipients);
+    }
+    else
+    {
+        const uint32_t chunkCount = (frameSize + this->chunkPayload - 1) / this->chunkPayload;
+        for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            CsiChunkHeader &chunkHeader = this->chunkHeaders[this->queued];
+            chunkHeader.magic = CSI_CHUNK_MAGIC;
+            chunkHeader.frameId = this->nextFrameId;
+            chunkHeader.frameSize = frameSize;
+            chunkHeader.offset = chunk * this->chunkPayload;
+            chunkHeader.chunkIndex = chunk;
+            chunkHeader.chunkCount = chunkCount;
+            this->queue(header, headerSize, payload, payloadSize, chunkHeader.offset, std::min(this->chunkPayload, frameSize - chunkHeader.offset), recipients);
+        }
+        this->nextFrameId++;
+    }
+
+    if (this->queued && now - this->firstQueued >= this->maxLatency)
+    {
+        this->flushLocked();
+    }
+}
+
+// Queues bytes [offset, offset + size) of the frame as one datagram, behind its chunk header when chunking
+void UdpBatchSender::queue(const void *header, size_t headerSize, const void *payload, size_t payloadSize, uint32_t offset, uint32_t size, UdpRecipients recipients)
+{
+    struct iovec *iov = &this->iovecs[this->queued * UDP_BATCH_IOVECS];
+    uint32_t count = 0;
+    if (this->chunkPayload)
+    {
+        iov[count++] = {&this->chunkHeaders[this->queued], sizeof(CsiChunkHeader)};
+    }
+    if (offset < headerSize)
+    {
+        const size_t part = std::min<size_t>(size, headerSize - offset);
+        iov[count++] = {static_cast<uint8_t *>(const_cast<void *>(header)) + offset, part};
+        offset += part;
+        size -= part;
+    }
+    if (size)
+    {
+        iov[count++] = {static_cast<uint8_t *>(const_cast<void *>(payload)) + (offset - headerSize), size};
+    }
+    this->messages[this->queued].msg_hdr.msg_iovlen = count;
+    this->recipients[this->queued] = recipients;
+    this->queued++;
+
+    if (this->queued == this->maxBatch)
+    {
+        this->flushLocked();
+        // A frame split over two batches continues in a new one
+        this->firstQueued = std::chrono::steady_clock::now();
+    }
+}
+
+void UdpBatchSender::flush()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->flushLocked();
+}
+
+bool UdpBatchSender::idle()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->queued == 0;
+}
+
+void UdpBatchSender::flushLocked()
+{
+    if (this->queued == 0)
+    {
+        return;
+    }
+    // Datagrams a subscriber can not take right now are dropped and counted by the socket
+    this->syscalls += this->udpSocket->send(this->messages.data(), this->recipients.data(), this->queued);
+    this->sentDatagrams += this->queued;
+    this->queued = 0;
+}
+
+void UdpBatchSender::flushLoop()
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (!this->stopping)
+    {
+        if (this->queued == 0)
+        {
+            this->wake.wait(lock);
+            continue;
+        }
+
+        const auto deadline = this->firstQueued + this->maxLatency;
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            this->timerFlushes++;
+            this->flushLocked();
+        }
+        else
+        {
+            this->wake.wait_until(lock, deadline);
+        }
+    }
+}
+
+void UdpBatchSender::printStatistics()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    Logger::log(info) << "UDP: " << this->addedFrames << " frames as " << this->sentDatagrams << " datagrams in " << this->syscalls << " sendmmsg calls";
+    if (this->syscalls)
+    {
+        Logger::log(info, true) << ", " << (double)this->addedFrames / this->syscalls << " frames/syscall";
+    }
+    Logger::log(info, true) << ", " << this->timerFlushes << " flushed by latency timer\n";
+    this->udpSocket->printStatistics();
+}
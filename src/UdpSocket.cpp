@@ -24,9 +24,15 @@
 #include <unistd.h>
 #include <string.h>
 #include <netdb.h>
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <sys/uio.h>
 #include "Logger.h"
 #include "Arguments.h"
 #include "MainController.h"
+#include "rs.h"
 
 #define PORT "8008"
 #define BUF_SIZE 1024
@@ -101,11 +107,25 @@ void UdpSocket::init()
             NI_MAXSERV,
             NI_NUMERICSERV);
         if (s == 0) {
-            if (strncmp(buf, "stop", 4) == 0) {
+            if (strncmp(buf, "subscribe", 9) == 0) {
+                try
+                {
+                    this->subscribe(peer_addr, peer_addr_len, buf + 9);
+                }
+                catch (const std::exception &e)
+                {
+                    Logger::log(error) << "Subscribe " << host << ":" << service << " failed: " << e.what() << "\n";
+                }
+            } else if (strncmp(buf, "unsubscribe", 11) == 0) {
+                this->unsubscribe(peer_addr, peer_addr_len);
+            } else if (strncmp(buf, "heartbeat", 9) == 0) {
+                this->heartbeat(peer_addr, peer_addr_len);
+            } else if (strncmp(buf, "stop", 4) == 0) {
                 if (this->running) {
                     mainController->restoreState();
                     this->running = false;
                 }
+                this->unsubscribeController();
             } else {
                 char *args[128];
                 std::istringstream iss(buf);
@@ -122,6 +142,14 @@ void UdpSocket::init()
                 }
 
                 Arguments::parse(index, &args[0]);
+                try
+                {
+                    this->subscribe(peer_addr, peer_addr_len, "", false);
+                }
+                catch (const std::exception &e)
+                {
+                    Logger::log(error) << "Subscribe " << host << ":" << service << " failed: " << e.what() << "\n";
+                }
 
                 for (int i = 0; i < index - 1; i++)
                     delete[] args[i];
@@ -138,15 +166,281 @@ void UdpSocket::init()
 
 void UdpSocket::send(char *buf, int size)
 {
-    if (
-        sendto(
-            sfd,
-            buf,
-            size,
-            0,
-            (struct sockaddr *)&peer_addr,
-            peer_addr_len) != size)
+    struct iovec iov = {buf, (size_t)size};
+    struct mmsghdr message = {};
+    message.msg_hdr.msg_iov = &iov;
+    message.msg_hdr.msg_iovlen = 1;
+    const UdpRecipients all = {UDP_ALL_SUBSCRIBERS, UINT64_MAX};
+    this->send(&message, &all, 1);
+}
+
+int UdpSocket::send(struct mmsghdr *messages, const UdpRecipients *recipients, unsigned int count)
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    this->expireSubscribers();
+
+    // One copy of the message header per subscriber, all point at the same iovecs
+    this->fanOut.clear();
+    this->fanOutSubscriber.clear();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        for (uint32_t s = 0; s < UDP_MAX_SUBSCRIBERS; s++)
+        {
+            UdpSubscriber &subscriber = this->subscribers[s];
+            // A slot freed and taken again since match() belongs to someone with other filters
+            if (!subscriber.active || !(recipients[i].mask & (1ULL << s)) || subscriber.generation > recipients[i].generation)
+            {
+                continue;
+            }
+            struct mmsghdr message = messages[i];
+            message.msg_hdr.msg_name = &subscriber.addr;
+            message.msg_hdr.msg_namelen = subscriber.addrLen;
+            this->fanOut.push_back(message);
+            this->fanOutSubscriber.push_back(s);
+        }
+    }
+
+    int syscalls = 0;
+    size_t sent = 0;
+    while (sent < this->fanOut.size())
+    {
+        const unsigned int batch = std::min<size_t>(this->fanOut.size() - sent, UIO_MAXIOV);
+        int result = sendmmsg(sfd, &this->fanOut[sent], batch, MSG_DONTWAIT);
+        syscalls++;
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result > 0)
+        {
+            for (int i = 0; i < result; i++)
+            {
+                this->subscribers[this->fanOutSubscriber[sent + i]].sentDatagrams++;
+            }
+            sent += result;
+        }
+        else
+        {
+            // Socket buffer full or subscriber unreachable, skip the datagram instead of waiting
+            this->subscribers[this->fanOutSubscriber[sent]].droppedDatagrams++;
+            sent++;
+        }
+    }
+    return syscalls;
+}
+
+UdpRecipients UdpSocket::match(const uint8_t *srcMac, uint32_t format, uint32_t channelWidth)
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    UdpRecipients recipients = {0, this->generation};
+    for (uint32_t s = 0; s < UDP_MAX_SUBSCRIBERS; s++)
+    {
+        UdpSubscriber &subscriber = this->subscribers[s];
+        if (!subscriber.active ||
+            (!subscriber.anyMac && memcmp(subscriber.mac, srcMac, sizeof(subscriber.mac)) != 0) ||
+            (subscriber.format != -1 && subscriber.format != format) ||
+            (subscriber.channelWidth != -1 && subscriber.channelWidth != channelWidth))
+        {
+            continue;
+        }
+        if (subscriber.matchedFrames++ % subscriber.every == 0)
+        {
+            recipients.mask |= 1ULL << s;
+        }
+    }
+    return recipients;
+}
+
+UdpSubscriber *UdpSocket::findSubscriber(const struct sockaddr_storage &addr, socklen_t addrLen)
+{
+    for (UdpSubscriber &subscriber : this->subscribers)
+    {
+        if (subscriber.active && subscriber.addrLen == addrLen && memcmp(&subscriber.addr, &addr, addrLen) == 0)
+        {
+            return &subscriber;
+        }
+    }
+    return nullptr;
+}
+
+void UdpSocket::subscribe(const struct sockaddr_storage &addr, socklen_t addrLen, const std::string &params, bool leased)
+{
+    UdpSubscriber subscriber;
+    subscriber.addr = addr;
+    subscriber.addrLen = addrLen;
+
+    std::istringstream paramStream(params);
+    std::string param;
+    while (paramStream >> param)
+    {
+        size_t separator = param.find('=');
+        std::string key = param.substr(0, separator);
+        std::string value = separator == std::string::npos ? "" : param.substr(separator + 1);
+        if (key == "mac")
+        {
+            if (sscanf(value.c_str(), "%2hhx:%2hhx:%2hhx:%2hhx:%2hhx:%2hhx", &subscriber.mac[0], &subscriber.mac[1], &subscriber.mac[2], &subscriber.mac[3], &subscriber.mac[4], &subscriber.mac[5]) != 6)
+            {
+                throw std::invalid_argument("Bad mac address: " + value);
+            }
+            subscriber.anyMac = false;
+        }
+        else if (key == "format")
+        {
+            static const std::map<std::string, uint32_t> formats = {
+                {"NOHT", RATE_MCS_LEGACY_OFDM_MSK}, {"HT", RATE_MCS_HT_MSK}, {"VHT", RATE_MCS_VHT_MSK}, {"HESU", RATE_MCS_HE_MSK}, {"EHT", RATE_MCS_EHT_MSK}};
+            auto format = formats.find(value);
+            if (format == formats.end())
+            {
+                throw std::invalid_argument("Unknown format: " + value);
+            }
+            subscriber.format = format->second;
+        }
+        else if (key == "width")
+        {
+            static const std::map<std::string, uint32_t> widths = {
+                {"20", RATE_MCS_CHAN_WIDTH_20}, {"40", RATE_MCS_CHAN_WIDTH_40}, {"80", RATE_MCS_CHAN_WIDTH_80}, {"160", RATE_MCS_CHAN_WIDTH_160}};
+            auto width = widths.find(value);
+            if (width == widths.end())
+            {
+                throw std::invalid_argument("Unknown width: " + value);
+            }
+            subscriber.channelWidth = width->second;
+        }
+        else if (key == "every")
+        {
+            subscriber.every = std::max(1, std::stoi(value));
+        }
+        else if (key == "lease")
+        {
+            subscriber.leaseS = std::max(1, std::stoi(value));
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown subscribe parameter: " + key);
+        }
+    }
+    subscriber.active = true;
+    subscriber.expires = leased ? std::chrono::steady_clock::now() + std::chrono::seconds(subscriber.leaseS) : std::chrono::steady_clock::time_point::max();
+
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    if (!leased)
+    {
+        // Only the client which started the latest measurement, e.g. from a new port after a restart
+        this->removeController(&addr, addrLen);
+    }
+    UdpSubscriber *existing = this->findSubscriber(addr, addrLen);
+    if (existing)
+    {
+        // New filters, counters continue
+        subscriber.matchedFrames = existing->matchedFrames;
+        subscriber.sentDatagrams = existing->sentDatagrams;
+        subscriber.droppedDatagrams = existing->droppedDatagrams;
+        subscriber.generation = existing->generation;
+        if (existing->expires == std::chrono::steady_clock::time_point::max())
+        {
+            subscriber.expires = existing->expires;
+        }
+        *existing = subscriber;
+        return;
+    }
+
+    this->expireSubscribers();
+    for (UdpSubscriber &free : this->subscribers)
+    {
+        if (!free.active)
+        {
+            free = subscriber;
+            free.generation = ++this->generation;
+            if (Arguments::arguments.verbose)
+            {
+                Logger::log(info) << "UDP subscriber added\n";
+            }
+            return;
+        }
+    }
+    throw std::length_error("Too many subscribers");
+}
+
+void UdpSocket::unsubscribe(const struct sockaddr_storage &addr, socklen_t addrLen)
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    UdpSubscriber *subscriber = this->findSubscriber(addr, addrLen);
+    if (subscriber)
     {
-        Logger::log(error) << "Error sending response \n";
+        if (Arguments::arguments.verbose)
+        {
+            Logger::log(info) << "UDP subscriber removed, " << subscriber->sentDatagrams << " datagrams sent, " << subscriber->droppedDatagrams << " dropped\n";
+        }
+        subscriber->active = false;
     }
-}
\ No newline at end of file
+}
+
+void UdpSocket::unsubscribeController()
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    this->removeController(nullptr, 0);
+}
+
+// Removes subscribers without lease except the one at keep, called with subscribersMutex held
+void UdpSocket::removeController(const struct sockaddr_storage *keep, socklen_t keepLen)
+{
+    for (UdpSubscriber &subscriber : this->subscribers)
+    {
+        if (!subscriber.active || subscriber.expires != std::chrono::steady_clock::time_point::max() ||
+            (keep && subscriber.addrLen == keepLen && memcmp(&subscriber.addr, keep, keepLen) == 0))
+        {
+            continue;
+        }
+        if (Arguments::arguments.verbose)
+        {
+            Logger::log(info) << "UDP subscriber removed, " << subscriber.sentDatagrams << " datagrams sent, " << subscriber.droppedDatagrams << " dropped\n";
+        }
+        subscriber.active = false;
+    }
+}
+
+void UdpSocket::heartbeat(const struct sockaddr_storage &addr, socklen_t addrLen)
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    UdpSubscriber *subscriber = this->findSubscriber(addr, addrLen);
+    if (subscriber && subscriber->expires != std::chrono::steady_clock::time_point::max())
+    {
+        subscriber->expires = std::chrono::steady_clock::now() + std::chrono::seconds(subscriber->leaseS);
+    }
+}
+
+// Called with subscribersMutex held
+void UdpSocket::expireSubscribers()
+{
+    const auto now = std::chrono::steady_clock::now();
+    for (UdpSubscriber &subscriber : this->subscribers)
+    {
+        if (subscriber.active && subscriber.expires < now)
+        {
+            if (Arguments::arguments.verbose)
+            {
+                Logger::log(info) << "UDP subscriber lease expired, " << subscriber.sentDatagrams << " datagrams sent, " << subscriber.droppedDatagrams << " dropped\n";
+            }
+            subscriber.active = false;
+        }
+    }
+}
+
+void UdpSocket::printStatistics()
+{
+    std::lock_guard<std::mutex> lock(this->subscribersMutex);
+    for (const UdpSubscriber &subscriber : this->subscribers)
+    {
+        if (!subscriber.active)
+        {
+            continue;
+        }
+        char host[NI_MAXHOST], service[NI_MAXSERV];
+        if (getnameinfo((struct sockaddr *)&subscriber.addr, subscriber.addrLen, host, NI_MAXHOST, service, NI_MAXSERV, NI_NUMERICHOST | NI_NUMERICSERV) != 0)
+        {
+            strcpy(host, "?");
+            strcpy(service, "?");
+        }
+        Logger::log(info) << "UDP subscriber " << host << ":" << service << ": " << subscriber.matchedFrames << " frames matched, " << subscriber.sentDatagrams << " datagrams sent, " << subscriber.droppedDatagrams << " dropped\n";
+    }
+}
@@ -18,10 +18,13 @@
 
 #include "WiFiCsiController.h"
 #include "Csi.h"
+#include "FeatureStage.h"
 #include "MainController.h"
+#include "MotionStage.h"
 #include "Arguments.h"
 
 #include <errno.h>
+#include <cstring>
 #include <netlink/genl/genl.h>
 #include <netlink/genl/family.h>
 #include <netlink/genl/ctrl.h>
@@ -39,6 +42,42 @@ void WiFiCsiController::init()
 {
     Netlink::init();
     this->enableCsi();
+    this->pipeline = ProcessingPipeline(Arguments::arguments.pipeline);
+    // Verbose runs compare every 100th frame with the floating point stages
+    this->fixedPoint = FixedPointProcessor(Arguments::arguments.fixedPoint, Arguments::arguments.verbose ? 100 : 0);
+
+    // Events and feature vectors go to the same UDP client as CSI frames
+    UdpSocket *udpSocket = MainController::getInstance()->udpSocket;
+    // Plotted frames are handed over to the GUI, batching and chunking need them to stay in the arena until sent
+    if (udpSocket && !Arguments::arguments.plot && (Arguments::arguments.udpBatch > 1 || Arguments::arguments.udpMtu))
+    {
+        this->udpSender = std::make_unique<UdpBatchSender>(udpSocket, Arguments::arguments.udpBatch, Arguments::arguments.udpLatency, Arguments::arguments.udpMtu);
+    }
+    if (!Arguments::arguments.stream.empty())
+    {
+        this->streamServer = std::make_unique<StreamServer>(Arguments::arguments.stream, Arguments::arguments.streamQueue, Arguments::arguments.streamOverflow);
+    }
+    for (const std::unique_ptr<ProcessingStage> &stage : this->pipeline.getStages())
+    {
+        if (!udpSocket)
+        {
+            break;
+        }
+        if (MotionStage *motion = dynamic_cast<MotionStage *>(stage.get()))
+        {
+            motion->addSink([udpSocket](const MotionEvent &event)
+                            { udpSocket->send((char *)&event, sizeof(MotionEvent)); });
+        }
+        if (FeatureStage *features = dynamic_cast<FeatureStage *>(stage.get()))
+        {
+            features->addSink([udpSocket](const FeatureVector &vector)
+                              {
+                std::vector<char> data(sizeof(FeatureHeader) + vector.values.size() * sizeof(float));
+                memcpy(data.data(), &vector.header, sizeof(FeatureHeader));
+                memcpy(data.data() + sizeof(FeatureHeader), vector.values.data(), vector.values.size() * sizeof(float));
+                udpSocket->send(data.data(), data.size()); });
+        }
+    }
 }
 
 int WiFiCsiController::listenToCsi()
@@ -66,6 +105,7 @@ nla_put_failure:
 
 int WiFiCsiController::processListenToCsiHandler(struct nl_msg *msg, void *arg)
 {
+    WiFiCsiController *wcc = (WiFiCsiController*) arg;
     struct nlattr *attrs[MAX_CMD + 1];
     struct nlmsghdr *nlh = nlmsg_hdr(msg);
 
@@ -89,8 +129,17 @@ int WiFiCsiController::processListenToCsiHandler(struct nl_msg *msg, void *arg)
             uint8_t *dataCsi = (uint8_t *)nla_data(attrs[IWL_MVM_VENDOR_ATTR_CSI_DATA]);
             memcpy(rawCsi, dataCsi, dataLength);
 
-            Csi *c = new Csi();
-            c->loadFromMemory(header, dataCsi);
+            // Plotted frames are handed over to and deleted by the GUI, all others live in the arena until sent.
+            // Released before the frame is created as add() of the previous frame leaves the sender busy
+            // until its latency budget passes, so the arena holds at most one latency window of frames.
+            if (!Arguments::arguments.plot && (!wcc->udpSender || wcc->udpSender->idle()))
+            {
+                wcc->arena.release();
+            }
+            Csi *c = Arguments::arguments.plot ? new Csi() : wcc->arena.createCsi();
+            bool queued = false;
+            // The fixed point path works on raw data, it is decoded afterwards only for stages and plots
+            c->loadFromMemory(header, dataCsi, wcc->fixedPoint.empty());
 
             if (
                 (c->channelWidth == RATE_MCS_CHAN_WIDTH_20 && Arguments::arguments.channelWidth == 20) ||
@@ -115,25 +164,51 @@ int WiFiCsiController::processListenToCsiHandler(struct nl_msg *msg, void *arg)
                         if (Arguments::arguments.verbose) {
                             printDetail(c);
                         }
-                        if ( MainController::getInstance()->udpSocket ) {
-                            c->sendUDP(MainController::getInstance()->udpSocket);
-                        } else {
-                            c->save();
+                        if (!wcc->fixedPoint.empty())
+                        {
+                            wcc->fixedPoint.process(*c);
+                            if (!wcc->pipeline.empty() || Arguments::arguments.plot)
+                            {
+                                c->reset();
+                            }
+                        }
+                        if (!wcc->pipeline.empty())
+                        {
+                            wcc->pipeline.process(*c);
+                        }
+                        if (!Arguments::arguments.eventsOnly)
+                        {
+                            // Stream clients get frames in addition to the UDP client, instead of the output file
+                            if (wcc->streamServer) {
+                                c->sendStream(wcc->streamServer.get());
+                            }
+                            if (wcc->udpSender) {
+                                c->sendUDP(wcc->udpSender.get(), MainController::getInstance()->udpSocket);
+                            } else if ( MainController::getInstance()->udpSocket ) {
+                                c->sendUDP(MainController::getInstance()->udpSocket);
+                            } else if (!wcc->streamServer) {
+                                c->save();
+                            }
                         }
                         if (Arguments::arguments.plot)
                         {
                             WiFiCsiController::csiQueueMutex.lock();
                             WiFiCsiController::csiQueue.push(c);
                             WiFiCsiController::csiQueueMutex.unlock();
+                            queued = true;
                         }
                     }
                     
                 }
             }
+
+            if (Arguments::arguments.plot && !queued)
+            {
+                delete c;
+            }
         }
     }
 
-    WiFiCsiController *wcc = (WiFiCsiController*) arg;
     auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
     if (wcc->stopTime != 0 && wcc->stopTime < now)
     {
@@ -231,5 +306,26 @@ void WiFiCsiController::enableCsi(bool enable)
 
 WiFiCsiController::~WiFiCsiController()
 {
+    if (Arguments::arguments.verbose)
+    {
+        this->pipeline.printStatistics();
+        if (!this->fixedPoint.empty())
+        {
+            this->fixedPoint.printStatistics();
+        }
+        this->arena.printStatistics();
+    }
+    if (this->streamServer && Arguments::arguments.verbose)
+    {
+        this->streamServer->printStatistics();
+    }
+    if (this->udpSender)
+    {
+        this->udpSender->flush();
+        if (Arguments::arguments.verbose)
+        {
+            this->udpSender->printStatistics();
+        }
+    }
     this->enableCsi(false);
 }
\ No newline at end of file
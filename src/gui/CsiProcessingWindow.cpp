@@ -22,6 +22,9 @@
 #include "Arguments.h"
 #include "CsiProcessingWindow.h"
 
+#include <iomanip>
+#include <sstream>
+
 void CsiProcessingWindow::init(Glib::RefPtr<Gtk::Builder> &builder)
 {
     this->inputFile = Glib::RefPtr<Gtk::FileChooserButton>::cast_dynamic(builder->get_object("inputFile"));
@@ -49,93 +52,122 @@ void CsiProcessingWindow::init(Glib::RefPtr<Gtk::Builder> &builder)
     this->processingSaveGtkButton->signal_clicked().connect(sigc::mem_fun(*this, &CsiProcessingWindow::processingSaveGtkButtonClicked));
 
     this->currentDataCount = Glib::RefPtr<Gtk::Label>::cast_dynamic(builder->get_object("currentDataCount"));
+    this->memoryUsageLabel = Glib::RefPtr<Gtk::Label>::cast_dynamic(builder->get_object("memoryUsageLabel"));
 }
 
 void CsiProcessingWindow::inputFileChange()
 {
     Arguments::arguments.inputFile = this->inputFile->get_filename();
-    csiProcessor.loadCsi();
-    this->refresh();
+    this->currentCsi.reset();
+    this->currentIndex = 0;
+    try
+    {
+        this->frameStore.open(Arguments::arguments.inputFile);
+    }
+    catch (const std::ios_base::failure &e)
+    {
+        Logger::log(error) << e.what() << '\n';
+        this->refresh();
+        return;
+    }
+    this->updatePipeline();
 }
 
 void CsiProcessingWindow::refresh()
 {
-    std::string indexLabelText = std::to_string(this->currentIndex) + " " + std::to_string(this->csiProcessor.csiData.size());
+    std::string indexLabelText = std::to_string(this->currentIndex) + " " + std::to_string(this->frameStore.size());
     
     this->currentDataCount->set_text(indexLabelText);
+
+    const double mib = 1024.0 * 1024.0;
+    std::ostringstream memoryText;
+    memoryText << std::fixed << std::setprecision(1) << this->frameStore.getMemoryUsage() / mib << " MiB decoded, " << this->frameStore.getMappedSize() / mib << " MiB mapped";
+    this->memoryUsageLabel->set_text(memoryText.str());
     
-/*     if (!this->csiProcessor.csiData.empty())
+/*     if (this->currentCsi)
     {
-        gnuPlot.updateChartAsync(this->csiProcessor.csiData[this->currentIndex]);
+        gnuPlot.updateChartAsync(this->currentCsi.get());
     } */
     
 }
 
+void CsiProcessingWindow::updatePipeline()
+{
+    this->currentCsi.reset();
+    this->frameStore.setPipeline(ProcessingPipeline::specFromProcessors(Arguments::arguments.processors));
+    this->showFrame(this->currentIndex);
+}
+
+void CsiProcessingWindow::showFrame(uint32_t index)
+{
+    if (index >= this->frameStore.size())
+    {
+        this->refresh();
+        return;
+    }
+    this->currentIndex = index;
+    this->currentCsi = this->frameStore.get(index);
+    this->refresh();
+}
+
 void CsiProcessingWindow::previousCsiButtonClicked()
 {
     if (this->currentIndex > 0)
     {
-        this->currentIndex--;
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->showFrame(this->currentIndex - 1);
     }
 }
 
 void CsiProcessingWindow::nextCsiButtonClicked()
 {
-    if (this->currentIndex < (this->csiProcessor.csiData.size() - 1))
+    if (this->currentIndex + 1 < this->frameStore.size())
     {
-        this->currentIndex++;
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->showFrame(this->currentIndex + 1);
     }
 }
 
 void CsiProcessingWindow::interpolationLinearRadioButtonClicked()
 {
-    if (!this->csiProcessor.csiData.empty())
+    if (this->frameStore.size())
     {
         Arguments::arguments.processors[processor::interpolateLinear] = this->interpolationLinearRadioButton->get_active();
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->updatePipeline();
     }
 }
 
 void CsiProcessingWindow::interpolationCubicRadioButtonClicked()
 {
-    if (!this->csiProcessor.csiData.empty())
+    if (this->frameStore.size())
     {
         Arguments::arguments.processors[processor::interpolateCubic] = this->interpolationCubicRadioButton->get_active();
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->updatePipeline();
     }
 }
 
 void CsiProcessingWindow::interpolationCosineButtonClicked()
 {
-    if (!this->csiProcessor.csiData.empty())
+    if (this->frameStore.size())
     {
         Arguments::arguments.processors[processor::interpolateCosine] = this->interpolationCosineButton->get_active();
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->updatePipeline();
     }
 }
 
 void CsiProcessingWindow::phaseLinearTransformCheckButtonClicked()
 {
-    if (!this->csiProcessor.csiData.empty())
+    if (this->frameStore.size())
     {
         Arguments::arguments.processors[processor::phaseCalibrationLinearTransform] = this->phaseLinearTransformCheckButton->get_active();
-        this->csiProcessor.process(*this->csiProcessor.csiData[this->currentIndex]);
-        this->refresh();
+        this->updatePipeline();
     }
 }
 
 void CsiProcessingWindow::processingSaveGtkButtonClicked()
 {
-    if (!this->csiProcessor.csiData.empty())
+    if (this->frameStore.size())
     {
         Arguments::arguments.outputFile = "processedCsi.bin";
-        this->csiProcessor.saveCsi();
+        this->csiProcessor.setPipeline(ProcessingPipeline::specFromProcessors(Arguments::arguments.processors));
+        this->csiProcessor.saveCsi(this->frameStore);
     }
 }
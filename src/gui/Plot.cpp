@@ -38,7 +38,7 @@ void Plot::init(Glib::RefPtr<Gtk::Box> box)
     show();
 }
 
-void Plot::updateData(Csi *csi, std::vector<double> *data)
+void Plot::updateData(Csi *csi, std::pmr::vector<double> *data)
 {
     this->csi = csi;
     this->data = data;
@@ -35,6 +35,12 @@ int main(int argc, char *argv[])
     args.init();
     args.parse(argc, argv);
 
+    // Output file is a directory here, empty puts outputs next to inputs
+    if (Arguments::arguments.process)
+    {
+        return MainController::runProcess();
+    }
+
     if (Arguments::arguments.outputFile.empty())
     {
         const auto t = std::chrono::system_clock::now();